@@ -0,0 +1,824 @@
+/*
+Date: 18/10/2026
+
+Description: This file contains the main function of Regression, the end to end benchmark of the
+engine.
+
+Usage: Regression [--corpus DIR] [--baseline FILE] [--threshold PERCENT]
+        [--time-threshold PERCENT] [--repetitions N] [--record] [--generate COUNT]
+
+Every solver engine solves every puzzle file of the corpus (hardest.txt and one generated file per
+difficulty) and every difficulty is generated from fixed seeds. For every case the throughput,
+the median and 99th percentile latency and the work are written as a table to stdout:
+
+        <case><TAB><items><TAB><items per second><TAB><p50 µs or -><TAB><p99 µs or -><TAB><work or ->
+
+The work is a count which only depends on the code, not on the machine: the search nodes of the
+backtracking and the Dancing Links solvers, and the solver calls of generating and filling grids.
+The batch engine has none.
+
+The latency of an item is its fastest time over the repetitions, the throughput is that of the
+fastest repetition. The batch engine solves its puzzles in lockstep and can not time them one
+by one, so it has no latencies.
+
+The table is then compared with the baseline (default DIR/baseline.tsv). By default only the
+deterministic columns decide: a case whose number of items changed or whose work grows by more
+than the threshold (default 0%) is a regression. The timings vary from run to run and from machine
+to machine, so their changes are only printed unless --time-threshold is given, which also fails a
+case whose throughput drops or whose p99 latency grows by more than that percentage. Use it on
+the machine the baseline was recorded on. With --record the table replaces the baseline instead,
+and with --generate the generated puzzle files are written again with COUNT puzzles each.
+
+The exit status is 0 without regressions, 1 with some and 2 on a usage or I/O error.
+*/
+
+#include "difficulty.hpp"
+#include "digger.hpp"
+#include "dlxSolver.hpp"
+#include "generator.hpp"
+#include "generatorPool.hpp"
+#include "grid.hpp"
+#include "macros.hpp"
+#include "puzzleFormat.hpp"
+#include "puzzleRunner.hpp"
+#include "random.hpp"
+#include "solver.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+        constexpr uint64_t CORPUS_SEED = 2026;                                  // Master seed of the generated puzzle files
+        constexpr uint64_t GENERATOR_SEED = 1810;                               // Master seed of the generator cases
+        constexpr size_t GENERATED = 16;                                        // Puzzles generated per difficulty and repetition
+        constexpr size_t FILLED = 256;                                          // Solved grids filled per repetition
+
+        /*
+        A generated puzzle file and the difficulty of its puzzles.
+        */
+        struct CorpusFile
+        {
+                const char* name;
+                Sudoku::Difficulty difficulty;                                  // NONE for the collected puzzles
+        };
+
+        constexpr std::array<CorpusFile, 5> CORPUS = {{
+                {"hardest", Sudoku::Difficulty::NONE},
+                {"easy", Sudoku::Difficulty::EASY},
+                {"medium", Sudoku::Difficulty::MEDIUM},
+                {"hard", Sudoku::Difficulty::HARD},
+                {"expert", Sudoku::Difficulty::EXPERT}
+        }};
+
+        constexpr std::array<Sudoku::Engine, 3> ENGINES = {
+                Sudoku::Engine::BACKTRACKING,
+                Sudoku::Engine::DANCING_LINKS,
+                Sudoku::Engine::BATCH
+        };
+
+        /*
+        Settings given on the command line.
+        */
+        struct Options
+        {
+                std::string corpus = "bench/corpus";                            // Directory of the puzzle files
+                std::string baseline;                                           // Empty uses corpus/baseline.tsv
+                double threshold = 0.0;                                         // Allowed growth of the work in percent
+                double timeThreshold = -1.0;                                    // Allowed change of the timings in percent, negative ignores them
+                size_t repetitions = 20;                                        // Runs of every case
+                bool record = false;                                            // Whether to replace the baseline
+                size_t generate = 0;                                            // Puzzles per generated file, 0 keeps the files
+        };
+
+        /*
+        Numbers of one case.
+        */
+        struct Measurement
+        {
+                std::string name;
+                size_t items = 0;                                               // Puzzles solved or generated per repetition
+                double throughput = 0.0;                                        // Items per second
+                double p50 = -1.0;                                              // Median latency in microseconds, -1 if not timed per item
+                double p99 = -1.0;                                              // 99th percentile latency in microseconds, -1 if not timed per item
+                int64_t work = -1;                                              // Search nodes or solver calls, -1 if not counted
+        };
+
+        /*
+        Prints the usage.
+
+        @param stream The stream to print to.
+        */
+        void printUsage(std::ostream& stream)
+        {
+                stream << "Usage: Regression [options]\n"
+                        << "Measures the solvers and the generator on the corpus and compares them with a baseline.\n\n"
+                        << "Options:\n"
+                        << "  -c, --corpus DIR        directory of the puzzle files (default bench/corpus)\n"
+                        << "  -b, --baseline FILE     baseline to compare with (default DIR/baseline.tsv)\n"
+                        << "  -t, --threshold PERCENT allowed growth of the work before a case fails (default 0)\n"
+                        << "      --time-threshold PERCENT\n"
+                        << "                          fail a case whose throughput drops or p99 grows by more than\n"
+                        << "                          PERCENT too (default off, the timings are informational)\n"
+                        << "  -r, --repetitions N     runs of every case (default 20)\n"
+                        << "      --record            write the results as the new baseline\n"
+                        << "      --generate COUNT    write the generated puzzle files again first\n"
+                        << "  -h, --help              print this help\n";
+        }
+
+        /*
+        Parses the command line.
+
+        @param argc The number of arguments.
+        @param argv The arguments.
+        @param options The options to fill.
+
+        @throw std::invalid_argument if an argument is not valid.
+        */
+        void parseOptions(int argc, char** argv, Options& options)
+        {
+                for (int k = 1; k < argc; k++)
+                {
+                        std::string argument = argv[k];
+                        bool hasValue = k + 1 < argc;
+
+                        if ((argument == "-c" || argument == "--corpus") && hasValue)
+                        {
+                                options.corpus = argv[++k];
+                        }
+                        else if ((argument == "-b" || argument == "--baseline") && hasValue)
+                        {
+                                options.baseline = argv[++k];
+                        }
+                        else if ((argument == "-t" || argument == "--threshold") && hasValue)
+                        {
+                                options.threshold = std::stod(argv[++k]);
+                        }
+                        else if (argument == "--time-threshold" && hasValue)
+                        {
+                                options.timeThreshold = std::stod(argv[++k]);
+                                if (options.timeThreshold < 0.0)
+                                {
+                                        throw std::invalid_argument("The time threshold must not be negative");
+                                }
+                        }
+                        else if ((argument == "-r" || argument == "--repetitions") && hasValue)
+                        {
+                                options.repetitions = std::max<size_t>(1, std::stoul(argv[++k]));
+                        }
+                        else if (argument == "--record")
+                        {
+                                options.record = true;
+                        }
+                        else if (argument == "--generate" && hasValue)
+                        {
+                                options.generate = std::stoul(argv[++k]);
+                        }
+                        else
+                        {
+                                throw std::invalid_argument("Unknown or incomplete option: " + argument);
+                        }
+                }
+
+                if (options.baseline.empty())
+                {
+                        options.baseline = options.corpus + "/baseline.tsv";
+                }
+        }
+
+        /*
+        Returns the nanoseconds elapsed since a point in time.
+
+        @param start The point in time.
+
+        @return The nanoseconds.
+        */
+        uint64_t elapsed(std::chrono::steady_clock::time_point start)
+        {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - start).count();
+        }
+
+        /*
+        Returns a percentile of latencies with the nearest rank method.
+
+        @param nanoseconds The latencies, reordered.
+        @param percent The percentile.
+
+        @return The percentile in microseconds.
+        */
+        double percentile(std::vector<uint64_t>& nanoseconds, double percent)
+        {
+                size_t rank = static_cast<size_t>(std::ceil(percent / 100.0 * nanoseconds.size()));
+                size_t index = std::min(nanoseconds.size() - 1, rank > 0 ? rank - 1 : 0);
+
+                std::nth_element(nanoseconds.begin(), nanoseconds.begin() + index, nanoseconds.end());
+
+                return nanoseconds[index] / 1000.0;
+        }
+
+        /*
+        Fills the statistics of a case from the fastest time of every item and the fastest
+        repetition.
+
+        @param measurement The case.
+        @param best The fastest time of every item, reordered.
+        @param fastest The time of the fastest repetition.
+        */
+        void summarize(Measurement& measurement, std::vector<uint64_t>& best, uint64_t fastest)
+        {
+                measurement.items = best.size();
+                measurement.throughput = fastest > 0 ? best.size() / (fastest / 1e9) : 0.0;
+                measurement.p50 = percentile(best, 50.0);
+                measurement.p99 = percentile(best, 99.0);
+        }
+
+        /*
+        Reads a puzzle file of the corpus. Empty lines and lines starting with '#' are skipped.
+
+        @param path The path of the file.
+
+        @return The puzzles.
+
+        @throw std::runtime_error if the file can not be read or a puzzle is not valid.
+        */
+        std::vector<Sudoku::PackedGrid> readPuzzles(const std::string& path)
+        {
+                std::ifstream file(path);
+                if (!file)
+                {
+                        throw std::runtime_error("Failed to open " + path);
+                }
+
+                std::vector<Sudoku::PackedGrid> puzzles;
+                std::string line;
+
+                while (std::getline(file, line))
+                {
+                        if (line.empty() || line[0] == '#')
+                        {
+                                continue;
+                        }
+
+                        Sudoku::PackedGrid packed;
+                        if (!Sudoku::PuzzleFormat::parse(line, packed))
+                        {
+                                throw std::runtime_error("Invalid puzzle in " + path + ": " + line);
+                        }
+                        puzzles.push_back(packed);
+                }
+
+                if (puzzles.empty())
+                {
+                        throw std::runtime_error("No puzzles in " + path);
+                }
+
+                return puzzles;
+        }
+
+        /*
+        Writes the generated puzzle files of the corpus. The puzzles only depend on CORPUS_SEED,
+        so the files can always be written again.
+
+        @param directory The corpus directory.
+        @param count The number of puzzles per file.
+
+        @throw std::runtime_error if a file can not be written.
+        */
+        void writeCorpus(const std::string& directory, size_t count)
+        {
+                Sudoku::GeneratorPool pool;
+
+                for (const CorpusFile& corpusFile : CORPUS)
+                {
+                        if (corpusFile.difficulty == Sudoku::Difficulty::NONE)
+                        {
+                                continue;
+                        }
+
+                        std::string path = directory + "/" + corpusFile.name + ".txt";
+                        std::ofstream file(path);
+
+                        file << "# " << count << " " << corpusFile.name << " puzzles of GeneratorPool with master seed "
+                                << CORPUS_SEED << ", written by Regression --generate " << count << '\n';
+                        for (const Sudoku::GeneratedPuzzle& puzzle : pool.generate(count, corpusFile.difficulty, CORPUS_SEED))
+                        {
+                                file << Sudoku::PuzzleFormat::format(puzzle.puzzle) << '\n';
+                        }
+
+                        file.flush();
+                        if (!file)
+                        {
+                                throw std::runtime_error("Failed to write " + path);
+                        }
+                }
+        }
+
+        /*
+        Counts the search nodes the backtracking solver visits on the puzzles. The counting solver
+        is a different build of the solver, so this is kept apart from the timed runs.
+
+        @param puzzles The puzzles.
+
+        @return The total number of nodes.
+        */
+        int64_t countNodes(const std::vector<Sudoku::PackedGrid>& puzzles)
+        {
+                Sudoku::StatsSolver solver;
+                Sudoku::Grid grid;
+                int64_t nodes = 0;
+
+                for (const Sudoku::PackedGrid& puzzle : puzzles)
+                {
+                        grid.unpack(puzzle);
+                        solver.solve(grid);
+                        nodes += solver.getStats().nodes;
+                }
+
+                return nodes;
+        }
+
+        /*
+        Counts the search nodes the Dancing Links solver visits on the puzzles.
+
+        @param puzzles The puzzles.
+
+        @return The total number of nodes.
+        */
+        int64_t countDlxNodes(const std::vector<Sudoku::PackedGrid>& puzzles)
+        {
+                Sudoku::DlxSolver solver;
+                Sudoku::Grid grid;
+                int64_t nodes = 0;
+
+                for (const Sudoku::PackedGrid& puzzle : puzzles)
+                {
+                        grid.unpack(puzzle);
+                        solver.solve(grid);
+                        nodes += solver.getNodes();
+                }
+
+                return nodes;
+        }
+
+        /*
+        Counts the solver calls of generating the puzzles of a difficulty, dug again the way
+        GeneratorPool::generateOne() digs them.
+
+        @param difficulty The difficulty.
+
+        @return The total number of solver calls.
+        */
+        int64_t countSolves(Sudoku::Difficulty difficulty)
+        {
+                Sudoku::Digger digger;
+                Sudoku::Grid puzzle;
+                Sudoku::Grid solution;
+                int64_t solves = 0;
+
+                digger.setTolerance(Sudoku::GIVENS_TOLERANCE);
+                for (size_t k = 0; k < GENERATED; k++)
+                {
+                        Sudoku::Random random(Sudoku::GeneratorPool::puzzleSeed(GENERATOR_SEED, k));
+                        digger.generate(puzzle, solution, static_cast<size_t>(difficulty), random);
+                        solves += digger.getSolves();
+                }
+
+                return solves;
+        }
+
+        /*
+        Measures an engine on a puzzle file, one puzzle at a time on a single thread.
+
+        @param engine The engine.
+        @param puzzles The puzzles.
+        @param repetitions The number of runs.
+        @param measurement Receives the numbers.
+
+        @throw std::runtime_error if a puzzle is not solved.
+        */
+        void measureSolver(Sudoku::Engine engine, const std::vector<Sudoku::PackedGrid>& puzzles,
+                size_t repetitions, Measurement& measurement)
+        {
+                Sudoku::PuzzleRunner runner(engine, 1);
+                std::vector<Sudoku::RunResult> results(puzzles.size());
+                std::vector<uint64_t> best(puzzles.size(), UINT64_MAX);
+                uint64_t fastest = UINT64_MAX;
+
+                // The first run only warms up the caches and the branch predictors
+                for (size_t repetition = 0; repetition <= repetitions; repetition++)
+                {
+                        std::vector<Sudoku::PackedGrid> grids = puzzles;
+
+                        auto start = std::chrono::steady_clock::now();
+                        size_t solved = runner.solve(grids.data(), grids.size(), results.data());
+                        fastest = std::min(fastest, elapsed(start));
+
+                        if (solved != puzzles.size())
+                        {
+                                throw std::runtime_error(measurement.name + " left puzzles unsolved");
+                        }
+                        if (repetition == 0)
+                        {
+                                fastest = UINT64_MAX;
+                                continue;
+                        }
+
+                        for (size_t k = 0; k < puzzles.size(); k++)
+                        {
+                                best[k] = std::min(best[k], results[k].nanoseconds);
+                        }
+                }
+
+                summarize(measurement, best, fastest);
+                if (engine == Sudoku::Engine::BATCH)
+                {
+                        // Every puzzle of a group gets the same share of its time
+                        measurement.p50 = -1.0;
+                        measurement.p99 = -1.0;
+                }
+                if (engine == Sudoku::Engine::BACKTRACKING)
+                {
+                        measurement.work = countNodes(puzzles);
+                }
+                if (engine == Sudoku::Engine::DANCING_LINKS)
+                {
+                        measurement.work = countDlxNodes(puzzles);
+                }
+        }
+
+        /*
+        Measures generating puzzles of a difficulty, every one from its own seed.
+
+        @param difficulty The difficulty.
+        @param repetitions The number of runs.
+        @param measurement Receives the numbers.
+        */
+        void measureGenerator(Sudoku::Difficulty difficulty, size_t repetitions, Measurement& measurement)
+        {
+                std::vector<uint64_t> best(GENERATED, UINT64_MAX);
+                uint64_t fastest = UINT64_MAX;
+
+                for (size_t repetition = 0; repetition < repetitions; repetition++)
+                {
+                        uint64_t total = 0;
+
+                        for (size_t k = 0; k < GENERATED; k++)
+                        {
+                                uint64_t seed = Sudoku::GeneratorPool::puzzleSeed(GENERATOR_SEED, k);
+
+                                auto start = std::chrono::steady_clock::now();
+                                Sudoku::GeneratorPool::generateOne(difficulty, seed);
+                                uint64_t time = elapsed(start);
+
+                                best[k] = std::min(best[k], time);
+                                total += time;
+                        }
+
+                        fastest = std::min(fastest, total);
+                }
+
+                summarize(measurement, best, fastest);
+                measurement.work = countSolves(difficulty);
+        }
+
+        /*
+        Measures filling solved grids with the Generator.
+
+        @param repetitions The number of runs.
+        @param measurement Receives the numbers.
+        */
+        void measureFill(size_t repetitions, Measurement& measurement)
+        {
+                Sudoku::Generator generator;
+                Sudoku::Grid grid;
+                std::vector<uint64_t> best(FILLED, UINT64_MAX);
+                uint64_t fastest = UINT64_MAX;
+                int64_t solves = 0;
+
+                for (size_t repetition = 0; repetition < repetitions; repetition++)
+                {
+                        Sudoku::Random random(GENERATOR_SEED);
+                        uint64_t total = 0;
+                        solves = 0;
+
+                        for (size_t k = 0; k < FILLED; k++)
+                        {
+                                auto start = std::chrono::steady_clock::now();
+                                generator.generate(grid, random);
+                                uint64_t time = elapsed(start);
+
+                                best[k] = std::min(best[k], time);
+                                total += time;
+                                solves += generator.getSolves();
+                        }
+
+                        fastest = std::min(fastest, total);
+                }
+
+                summarize(measurement, best, fastest);
+                measurement.work = solves;
+        }
+
+        /*
+        Writes a column of a table, a dash if the value is missing.
+
+        @param stream The stream to write to.
+        @param value The value, negative if missing.
+        @param format The printf format of the value.
+        */
+        void writeColumn(std::ostream& stream, double value, const char* format)
+        {
+                char text[64];
+
+                if (value < 0.0)
+                {
+                        stream << "\t-";
+                        return;
+                }
+
+                std::snprintf(text, sizeof(text), format, value);
+                stream << '\t' << text;
+        }
+
+        /*
+        Reads a column written by writeColumn().
+
+        @param text The column.
+
+        @return The value, -1 if missing.
+        */
+        double readColumn(const std::string& text)
+        {
+                return text == "-" ? -1.0 : std::stod(text);
+        }
+
+        /*
+        Writes measurements as a table.
+
+        @param stream The stream to write to.
+        @param measurements The measurements.
+        */
+        void writeTable(std::ostream& stream, const std::vector<Measurement>& measurements)
+        {
+                stream << "# case\titems\tper_second\tp50_us\tp99_us\twork\n";
+                for (const Measurement& measurement : measurements)
+                {
+                        stream << measurement.name << '\t' << measurement.items;
+                        writeColumn(stream, measurement.throughput, "%.1f");
+                        writeColumn(stream, measurement.p50, "%.3f");
+                        writeColumn(stream, measurement.p99, "%.3f");
+                        writeColumn(stream, static_cast<double>(measurement.work), "%.0f");
+                        stream << '\n';
+                }
+        }
+
+        /*
+        Reads a table written by writeTable().
+
+        @param path The path of the table.
+
+        @return The measurements by case.
+
+        @throw std::runtime_error if the file can not be read or a line is not valid.
+        */
+        std::map<std::string, Measurement> readTable(const std::string& path)
+        {
+                std::ifstream file(path);
+                if (!file)
+                {
+                        throw std::runtime_error("Failed to open " + path);
+                }
+
+                std::map<std::string, Measurement> measurements;
+                std::string line;
+
+                while (std::getline(file, line))
+                {
+                        if (line.empty() || line[0] == '#')
+                        {
+                                continue;
+                        }
+
+                        std::istringstream fields(line);
+                        Measurement measurement;
+                        std::string throughput;
+                        std::string p50;
+                        std::string p99;
+                        std::string work;
+
+                        if (!(fields >> measurement.name >> measurement.items >> throughput >> p50 >> p99 >> work))
+                        {
+                                throw std::runtime_error("Invalid line in " + path + ": " + line);
+                        }
+
+                        try
+                        {
+                                measurement.throughput = readColumn(throughput);
+                                measurement.p50 = readColumn(p50);
+                                measurement.p99 = readColumn(p99);
+                                measurement.work = work == "-" ? -1 : std::stoll(work);
+                        }
+                        catch (const std::exception&)
+                        {
+                                throw std::runtime_error("Invalid line in " + path + ": " + line);
+                        }
+
+                        measurements[measurement.name] = measurement;
+                }
+
+                return measurements;
+        }
+
+        /*
+        Returns the change from a baseline value in percent.
+
+        @param current The current value.
+        @param baseline The baseline value.
+
+        @return The change, 0 if the baseline is 0 or a value is missing.
+        */
+        double change(double current, double baseline)
+        {
+                return baseline > 0.0 && current >= 0.0 ? (current - baseline) / baseline * 100.0 : 0.0;
+        }
+
+        /*
+        Compares measurements with the baseline and prints a line for every case. The items and
+        the work always decide, the throughput and the p99 latency only with a time threshold.
+
+        @param measurements The measurements.
+        @param baseline The baseline by case.
+        @param threshold The allowed growth of the work in percent.
+        @param timeThreshold The allowed loss of throughput and growth of p99 in percent, negative
+                if the timings do not decide.
+
+        @return The number of regressed cases.
+        */
+        size_t compare(const std::vector<Measurement>& measurements,
+                const std::map<std::string, Measurement>& baseline, double threshold, double timeThreshold)
+        {
+                size_t regressions = 0;
+                char line[256];
+
+                for (const Measurement& measurement : measurements)
+                {
+                        auto found = baseline.find(measurement.name);
+                        if (found == baseline.end())
+                        {
+                                std::cerr << "  new       " << measurement.name << '\n';
+                                continue;
+                        }
+
+                        const Measurement& old = found->second;
+                        double throughput = change(measurement.throughput, old.throughput);
+                        double p50 = change(measurement.p50, old.p50);
+                        double p99 = change(measurement.p99, old.p99);
+                        double work = change(measurement.work, old.work);
+
+                        // The same puzzles must take the same work, the timings only decide on request
+                        bool regressed = measurement.items != old.items || work > threshold
+                                || (measurement.work >= 0) != (old.work >= 0);
+                        if (timeThreshold >= 0.0)
+                        {
+                                regressed = regressed || throughput < -timeThreshold || p99 > timeThreshold;
+                        }
+                        regressions += regressed;
+
+                        std::snprintf(line, sizeof(line), "  %-9s %-32s %+7.1f%% /s %+7.1f%% p50 %+7.1f%% p99 %+7.1f%% work\n",
+                                regressed ? "REGRESSED" : "ok", measurement.name.c_str(), throughput, p50, p99, work);
+                        std::cerr << line;
+                }
+
+                return regressions;
+        }
+} // namespace
+
+int main(int argc, char** argv)
+{
+        #ifdef DEVELOPMENT
+        // The log would slow down and drown the measurements
+        SET_LOG_LEVEL_OFF();
+        #endif // DEVELOPMENT
+
+        Options options;
+
+        try
+        {
+                for (int k = 1; k < argc; k++)
+                {
+                        if (std::string(argv[k]) == "-h" || std::string(argv[k]) == "--help")
+                        {
+                                printUsage(std::cout);
+                                return 0;
+                        }
+                }
+
+                parseOptions(argc, argv, options);
+        }
+        catch (const std::exception& exception)
+        {
+                std::cerr << "Regression: " << exception.what() << "\n\n";
+                printUsage(std::cerr);
+                return 2;
+        }
+
+        std::vector<Measurement> measurements;
+
+        try
+        {
+                if (options.generate > 0)
+                {
+                        std::cerr << "Writing " << options.generate << " puzzles per difficulty to " << options.corpus << '\n';
+                        writeCorpus(options.corpus, options.generate);
+                }
+
+                for (const CorpusFile& corpusFile : CORPUS)
+                {
+                        std::vector<Sudoku::PackedGrid> puzzles = readPuzzles(options.corpus + "/" + corpusFile.name + ".txt");
+
+                        for (Sudoku::Engine engine : ENGINES)
+                        {
+                                Measurement measurement;
+                                measurement.name = std::string("solve/") + Sudoku::PuzzleRunner::getName(engine) + "/" + corpusFile.name;
+                                measureSolver(engine, puzzles, options.repetitions, measurement);
+                                measurements.push_back(measurement);
+                        }
+                }
+
+                for (const CorpusFile& corpusFile : CORPUS)
+                {
+                        if (corpusFile.difficulty != Sudoku::Difficulty::NONE)
+                        {
+                                Measurement measurement;
+                                measurement.name = std::string("generate/") + corpusFile.name;
+                                measureGenerator(corpusFile.difficulty, options.repetitions, measurement);
+                                measurements.push_back(measurement);
+                        }
+                }
+
+                Measurement fill;
+                fill.name = "fill";
+                measureFill(options.repetitions, fill);
+                measurements.push_back(fill);
+        }
+        catch (const std::exception& exception)
+        {
+                std::cerr << "Regression: " << exception.what() << '\n';
+                return 2;
+        }
+
+        writeTable(std::cout, measurements);
+
+        if (options.record)
+        {
+                std::ofstream file(options.baseline);
+                writeTable(file, measurements);
+                file.flush();
+
+                if (!file)
+                {
+                        std::cerr << "Regression: Failed to write " << options.baseline << '\n';
+                        return 2;
+                }
+
+                std::cerr << "Baseline written to " << options.baseline << '\n';
+                return 0;
+        }
+
+        std::map<std::string, Measurement> baseline;
+        try
+        {
+                baseline = readTable(options.baseline);
+        }
+        catch (const std::exception& exception)
+        {
+                std::cerr << "Regression: " << exception.what() << '\n';
+                return 2;
+        }
+
+        std::cerr << "Compared with " << options.baseline << " (work threshold " << options.threshold << "%, ";
+        if (options.timeThreshold >= 0.0)
+        {
+                std::cerr << "time threshold " << options.timeThreshold << "%):\n";
+        }
+        else
+        {
+                std::cerr << "the timings are informational):\n";
+        }
+        size_t regressions = compare(measurements, baseline, options.threshold, options.timeThreshold);
+        std::cerr << regressions << " of " << measurements.size() << " cases regressed\n";
+
+        return regressions == 0 ? 0 : 1;
+}
@@ -0,0 +1,103 @@
+/*
+Date: 18/10/2026
+
+This file provides benchmarks for the BatchSolver class.
+*/
+
+#ifndef BENCH
+#error "Tried to compile a benchmark file without the BENCH macro defined. Aborting compilation."
+#else
+
+#include "batchSolver.hpp"
+#include "generator.hpp"
+#include "grid.hpp"
+#include "random.hpp"
+#include "solver.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+namespace
+{
+        /*
+        Generates puzzles by emptying random cells of generated grids. The same seed always
+        gives the same puzzles.
+
+        @param count The number of puzzles.
+        @param emptyCells The number of cells to empty in every puzzle.
+
+        @return The packed puzzles.
+        */
+        std::vector<Sudoku::PackedGrid> makePuzzles(size_t count, size_t emptyCells)
+        {
+                Sudoku::Random random(42);
+                Sudoku::Generator generator;
+                Sudoku::Grid grid;
+                std::vector<Sudoku::PackedGrid> puzzles(count);
+
+                for (Sudoku::PackedGrid& puzzle : puzzles)
+                {
+                        generator.generate(grid, random);
+
+                        for (size_t i = 0; i < emptyCells; i++)
+                        {
+                                grid.setCell(random.below(81), 0);
+                        }
+
+                        grid.pack(puzzle);
+                }
+
+                return puzzles;
+        }
+} // namespace
+
+/*
+Solves a batch of puzzles one by one with Solver::solve(), the reference for the batch solver.
+*/
+static void BM_SolveEach(benchmark::State& state)
+{
+        const std::vector<Sudoku::PackedGrid> puzzles = makePuzzles(1024, state.range(0));
+        Sudoku::Grid grid;
+        Sudoku::Solver solver;
+
+        for (auto _ : state)
+        {
+                for (const Sudoku::PackedGrid& puzzle : puzzles)
+                {
+                        grid.unpack(puzzle);
+                        benchmark::DoNotOptimize(solver.solve(grid));
+                }
+        }
+
+        state.SetItemsProcessed(state.iterations() * puzzles.size());
+}
+BENCHMARK(BM_SolveEach)->Arg(40)->Arg(80);
+
+/*
+Solves a batch of puzzles with BatchSolver::solve() using the given instruction set.
+*/
+static void BM_SolveBatch(benchmark::State& state, Sudoku::InstructionSet instructionSet)
+{
+        if (!Sudoku::BatchSolver::isSupported(instructionSet))
+        {
+                state.SkipWithError("Instruction set not supported by the CPU");
+                return;
+        }
+
+        const std::vector<Sudoku::PackedGrid> puzzles = makePuzzles(1024, state.range(0));
+        std::vector<Sudoku::PackedGrid> grids;
+        std::vector<Sudoku::SolverStatus> statuses(puzzles.size());
+        Sudoku::BatchSolver solver(instructionSet);
+
+        for (auto _ : state)
+        {
+                grids = puzzles;
+                benchmark::DoNotOptimize(solver.solve(grids.data(), grids.size(), statuses.data()));
+        }
+
+        state.SetItemsProcessed(state.iterations() * puzzles.size());
+}
+BENCHMARK_CAPTURE(BM_SolveBatch, Scalar, Sudoku::InstructionSet::SCALAR)->Arg(40)->Arg(80);
+BENCHMARK_CAPTURE(BM_SolveBatch, Sse2, Sudoku::InstructionSet::SSE2)->Arg(40)->Arg(80);
+BENCHMARK_CAPTURE(BM_SolveBatch, Avx2, Sudoku::InstructionSet::AVX2)->Arg(40)->Arg(80);
+
+#endif // !BENCH
@@ -0,0 +1,141 @@
+/*
+Date: 18/10/2026
+
+This file provides throughput benchmarks for the Canonicalizer class.
+*/
+
+#ifndef BENCH
+#error "Tried to compile a benchmark file without the BENCH macro defined. Aborting compilation."
+#else
+
+#include "canonicalizer.hpp"
+#include "digger.hpp"
+#include "generator.hpp"
+#include "grid.hpp"
+#include "random.hpp"
+#include "transformer.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+        constexpr size_t GRIDS = 64;
+
+        /*
+        Generates solved grids to canonicalize.
+
+        @return The grids.
+        */
+        std::vector<Sudoku::Grid> solvedGrids()
+        {
+                Sudoku::Generator generator;
+                Sudoku::Random random(42);
+                std::vector<Sudoku::Grid> grids(GRIDS);
+
+                for (Sudoku::Grid& grid : grids)
+                {
+                        generator.generate(grid, random);
+                }
+
+                return grids;
+        }
+} // namespace
+
+/*
+Canonicalizes solved grids.
+*/
+static void BM_CanonicalizeSolved(benchmark::State& state)
+{
+        Sudoku::Canonicalizer canonicalizer;
+        std::vector<Sudoku::Grid> grids = solvedGrids();
+        Sudoku::Grid result;
+        size_t k = 0;
+
+        for (auto _ : state)
+        {
+                canonicalizer.canonicalize(grids[k++ % GRIDS], result);
+                benchmark::DoNotOptimize(result);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CanonicalizeSolved);
+
+/*
+Canonicalizes puzzles whose solution is known.
+*/
+static void BM_CanonicalizePuzzle(benchmark::State& state)
+{
+        Sudoku::Canonicalizer canonicalizer;
+        Sudoku::Digger digger;
+        Sudoku::Random random(42);
+        std::vector<Sudoku::Grid> puzzles(GRIDS);
+        std::vector<Sudoku::Grid> solutions(GRIDS);
+        Sudoku::Grid result;
+        size_t k = 0;
+
+        for (size_t i = 0; i < GRIDS; i++)
+        {
+                digger.generate(puzzles[i], solutions[i], 30, random);
+        }
+
+        for (auto _ : state)
+        {
+                canonicalizer.canonicalize(puzzles[k % GRIDS], solutions[k % GRIDS], result);
+                benchmark::DoNotOptimize(result);
+                k++;
+        }
+
+        state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CanonicalizePuzzle);
+
+/*
+Hashes a canonical grid.
+*/
+static void BM_Hash(benchmark::State& state)
+{
+        std::vector<Sudoku::Grid> grids = solvedGrids();
+        size_t k = 0;
+
+        for (auto _ : state)
+        {
+                benchmark::DoNotOptimize(Sudoku::Canonicalizer::hash(grids[k++ % GRIDS]));
+        }
+
+        state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Hash);
+
+/*
+Deduplicates random transformations of a few grids by their fingerprints.
+*/
+static void BM_Deduplicate(benchmark::State& state)
+{
+        Sudoku::Canonicalizer canonicalizer;
+        Sudoku::Random random(7);
+        std::vector<Sudoku::Grid> grids = solvedGrids();
+        std::vector<Sudoku::Grid> images(1024);
+
+        for (size_t i = 0; i < images.size(); i++)
+        {
+                Sudoku::Transformer::apply(Sudoku::Transformer::random(random), grids[i % 8], images[i]);
+        }
+
+        for (auto _ : state)
+        {
+                std::unordered_set<uint64_t> fingerprints;
+                for (const Sudoku::Grid& image : images)
+                {
+                        fingerprints.insert(canonicalizer.fingerprint(image));
+                }
+                benchmark::DoNotOptimize(fingerprints.size());
+        }
+
+        state.SetItemsProcessed(state.iterations() * images.size());
+}
+BENCHMARK(BM_Deduplicate);
+
+#endif // !BENCH
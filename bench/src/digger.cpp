@@ -0,0 +1,40 @@
+/*
+Date: 18/10/2026
+
+This file provides benchmarks for the Digger class.
+*/
+
+#ifndef BENCH
+#error "Tried to compile a benchmark file without the BENCH macro defined. Aborting compilation."
+#else
+
+#include "digger.hpp"
+#include "grid.hpp"
+#include "random.hpp"
+#include <benchmark/benchmark.h>
+
+/*
+Generates a puzzle with a unique solution and the given number of givens.
+*/
+static void BM_DiggerGenerate(benchmark::State& state, Sudoku::Symmetry symmetry)
+{
+        Sudoku::Digger digger;
+        Sudoku::Random random(42);
+        Sudoku::Grid puzzle;
+        Sudoku::Grid solution;
+        size_t givens = 0;
+
+        for (auto _ : state)
+        {
+                digger.generate(puzzle, solution, state.range(0), random, symmetry);
+                givens += puzzle.size() - puzzle.count(0);
+        }
+
+        state.counters["givens"] = benchmark::Counter(givens, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK_CAPTURE(BM_DiggerGenerate, None, Sudoku::Symmetry::NONE)
+        ->Arg(36)->Arg(31)->Arg(26)->Arg(21)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DiggerGenerate, Rotational, Sudoku::Symmetry::ROTATIONAL)
+        ->Arg(26)->Arg(21)->Unit(benchmark::kMillisecond);
+
+#endif // !BENCH
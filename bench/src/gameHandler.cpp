@@ -0,0 +1,37 @@
+/*
+Date: 18/10/2026
+
+This file provides benchmarks for starting games of every difficulty with GameHandler.
+*/
+
+#ifndef BENCH
+#error "Tried to compile a benchmark file without the BENCH macro defined. Aborting compilation."
+#else
+
+#include "difficulty.hpp"
+#include "gameHandler.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+/*
+Starts new games of a difficulty, every one from its own seed. Without a bank next to the
+benchmark the puzzles are dug on the spot, see bench/src/puzzleBank.cpp for the bank.
+*/
+static void BM_NewGame(benchmark::State& state, Sudoku::Difficulty difficulty)
+{
+        Sudoku::GameHandler game;
+        uint64_t seed = 0;
+
+        for (auto _ : state)
+        {
+                game.newGame(difficulty, seed++);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_NewGame, Easy, Sudoku::Difficulty::EASY)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_NewGame, Medium, Sudoku::Difficulty::MEDIUM)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_NewGame, Hard, Sudoku::Difficulty::HARD)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_NewGame, Expert, Sudoku::Difficulty::EXPERT)->Unit(benchmark::kMicrosecond);
+
+#endif // !BENCH
@@ -0,0 +1,54 @@
+/*
+Date: 18/10/2026
+
+This file provides benchmarks for the Generator class.
+*/
+
+#ifndef BENCH
+#error "Tried to compile a benchmark file without the BENCH macro defined. Aborting compilation."
+#else
+
+#include "generator.hpp"
+#include "grid.hpp"
+#include "random.hpp"
+#include <benchmark/benchmark.h>
+
+/*
+Generates solved grids from one seeded random number generator.
+*/
+static void BM_Generate(benchmark::State& state)
+{
+        Sudoku::Generator generator;
+        Sudoku::Random random(42);
+        Sudoku::Grid grid;
+
+        for (auto _ : state)
+        {
+                generator.generate(grid, random);
+                benchmark::DoNotOptimize(grid);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Generate);
+
+/*
+Generates a solved grid and empties cells at random, without checking uniqueness. This is the
+cheapest way to a puzzle, see bench/src/digger.cpp for unique ones.
+*/
+static void BM_GenerateAndEmpty(benchmark::State& state)
+{
+        Sudoku::Generator generator;
+        Sudoku::Random random(42);
+        Sudoku::Grid grid;
+
+        for (auto _ : state)
+        {
+                generator.generate(grid, random);
+                grid.setZero(81 - state.range(0), random);
+                benchmark::DoNotOptimize(grid);
+        }
+}
+BENCHMARK(BM_GenerateAndEmpty)->Arg(36)->Arg(21);
+
+#endif // !BENCH
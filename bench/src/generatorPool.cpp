@@ -0,0 +1,34 @@
+/*
+Date: 18/10/2026
+
+This file provides benchmarks for the GeneratorPool class.
+*/
+
+#ifndef BENCH
+#error "Tried to compile a benchmark file without the BENCH macro defined. Aborting compilation."
+#else
+
+#include "gameHandler.hpp"
+#include "generatorPool.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+/*
+Generates a batch of puzzles with the given number of threads.
+*/
+static void BM_GeneratorPool(benchmark::State& state)
+{
+        const size_t count = 4096;
+        Sudoku::GeneratorPool pool(state.range(0));
+        uint64_t seed = 0;
+
+        for (auto _ : state)
+        {
+                benchmark::DoNotOptimize(pool.generate(count, Sudoku::Difficulty::MEDIUM, seed++));
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_GeneratorPool)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+#endif // !BENCH
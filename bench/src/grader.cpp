@@ -0,0 +1,47 @@
+/*
+Date: 18/10/2026
+
+This file provides benchmarks for the Grader class.
+*/
+
+#ifndef BENCH
+#error "Tried to compile a benchmark file without the BENCH macro defined. Aborting compilation."
+#else
+
+#include "digger.hpp"
+#include "grader.hpp"
+#include "grid.hpp"
+#include "random.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+/*
+Grades a set of unique puzzles with the given number of givens.
+*/
+static void BM_Grade(benchmark::State& state)
+{
+        Sudoku::Digger digger;
+        Sudoku::Random random(42);
+        Sudoku::Grid solution;
+        std::vector<Sudoku::Grid> puzzles(256);
+
+        for (Sudoku::Grid& puzzle : puzzles)
+        {
+                digger.generate(puzzle, solution, state.range(0), random);
+        }
+
+        Sudoku::Grader grader;
+
+        for (auto _ : state)
+        {
+                for (const Sudoku::Grid& puzzle : puzzles)
+                {
+                        benchmark::DoNotOptimize(grader.grade(puzzle));
+                }
+        }
+
+        state.SetItemsProcessed(state.iterations() * puzzles.size());
+}
+BENCHMARK(BM_Grade)->Arg(36)->Arg(26);
+
+#endif // !BENCH
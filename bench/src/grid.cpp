@@ -0,0 +1,117 @@
+/*
+Date: 18/10/2026
+
+This file provides benchmarks for the checks and the hash of the Grid class. Build with and
+without the GRID_HASH option to compare the incremental hash with hashing every cell.
+*/
+
+#ifndef BENCH
+#error "Tried to compile a benchmark file without the BENCH macro defined. Aborting compilation."
+#else
+
+#include "generator.hpp"
+#include "grid.hpp"
+#include "random.hpp"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+/*
+Checks every value for every cell of a puzzle, the way the GUI validates the player's input.
+*/
+static void BM_IsValidValueToSet(benchmark::State& state)
+{
+        Sudoku::Generator generator;
+        Sudoku::Random random(42);
+        Sudoku::Grid grid;
+        generator.generate(grid, random);
+        grid.setZero(45, random);
+
+        for (auto _ : state)
+        {
+                int valid = 0;
+                for (size_t i = 0; i < 81; i++)
+                {
+                        for (int value = 1; value <= 9; value++)
+                        {
+                                valid += grid.isValidValueToSet(i, value);
+                        }
+                }
+                benchmark::DoNotOptimize(valid);
+        }
+
+        state.SetItemsProcessed(state.iterations() * 81 * 9);
+}
+BENCHMARK(BM_IsValidValueToSet);
+
+/*
+Checks if a grid is solved, the game does it after every move. Argument 0 is a solved grid,
+argument 1 a grid with its last cell empty.
+*/
+static void BM_IsSolved(benchmark::State& state)
+{
+        Sudoku::Generator generator;
+        Sudoku::Random random(42);
+        Sudoku::Grid grid;
+        generator.generate(grid, random);
+
+        if (state.range(0) != 0)
+        {
+                grid.setCell(80, 0);
+        }
+
+        for (auto _ : state)
+        {
+                benchmark::DoNotOptimize(grid.isSolved());
+        }
+}
+BENCHMARK(BM_IsSolved)->Arg(0)->Arg(1);
+
+/*
+Changes one cell and reads the hash, the way a solver would look up a transposition table.
+*/
+static void BM_WriteAndHash(benchmark::State& state)
+{
+        Sudoku::Generator generator;
+        Sudoku::Random random(42);
+        Sudoku::Grid grid;
+        generator.generate(grid, random);
+        size_t cell = 0;
+
+        for (auto _ : state)
+        {
+                int value = grid.getCellUnchecked(cell);
+                grid.setCellUnchecked(cell, 0);
+                benchmark::DoNotOptimize(grid.hash());
+                grid.setCellUnchecked(cell, value);
+                cell = (cell + 7) % 81;
+        }
+}
+BENCHMARK(BM_WriteAndHash);
+
+/*
+Writes a solved grid cell by cell, the hash adds to every write.
+*/
+static void BM_WriteGrid(benchmark::State& state)
+{
+        Sudoku::Generator generator;
+        Sudoku::Random random(42);
+        Sudoku::Grid solved;
+        Sudoku::Grid grid;
+        generator.generate(solved, random);
+
+        for (auto _ : state)
+        {
+                for (size_t i = 0; i < 81; i++)
+                {
+                        grid.setCellUnchecked(i, solved.getCellUnchecked(i));
+                }
+                for (size_t i = 0; i < 81; i++)
+                {
+                        grid.setCellUnchecked(i, 0);
+                }
+                benchmark::DoNotOptimize(grid);
+        }
+}
+BENCHMARK(BM_WriteGrid);
+
+#endif // !BENCH
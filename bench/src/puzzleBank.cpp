@@ -0,0 +1,55 @@
+/*
+Date: 18/10/2026
+
+This file provides benchmarks for starting a game from a PuzzleBank.
+*/
+
+#ifndef BENCH
+#error "Tried to compile a benchmark file without the BENCH macro defined. Aborting compilation."
+#else
+
+#include "difficulty.hpp"
+#include "gameHandler.hpp"
+#include "puzzleBank.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+/*
+Starts new games with the puzzles generated on the spot.
+*/
+static void BM_NewGameGenerated(benchmark::State& state)
+{
+        Sudoku::GameHandler game;
+        uint64_t seed = 0;
+
+        for (auto _ : state)
+        {
+                game.newGame(static_cast<Sudoku::Difficulty>(state.range(0)), seed++);
+        }
+}
+BENCHMARK(BM_NewGameGenerated)->Arg(36)->Arg(26)->Unit(benchmark::kMicrosecond);
+
+/*
+Starts new games with the puzzles picked from a bank.
+*/
+static void BM_NewGameBank(benchmark::State& state)
+{
+        const std::string path = (std::filesystem::temp_directory_path() / "sudoku_bench.bank").string();
+        Sudoku::PuzzleBank::build(path, {1024, 0, 1024, 0}, 42);
+
+        Sudoku::GameHandler game;
+        game.openBank(path);
+        uint64_t seed = 0;
+
+        for (auto _ : state)
+        {
+                game.newGame(static_cast<Sudoku::Difficulty>(state.range(0)), seed++);
+        }
+
+        std::filesystem::remove(path);
+}
+BENCHMARK(BM_NewGameBank)->Arg(36)->Arg(26)->Unit(benchmark::kMicrosecond);
+
+#endif // !BENCH
@@ -0,0 +1,185 @@
+/*
+Date: 18/10/2026
+
+This file provides benchmarks for the Solver class.
+*/
+
+#ifndef BENCH
+#error "Tried to compile a benchmark file without the BENCH macro defined. Aborting compilation."
+#else
+
+#include "dlxSolver.hpp"
+#include "grid.hpp"
+#include "solver.hpp"
+#include "solverStrategy.hpp"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+
+namespace
+{
+        const std::string EASY_PUZZLE =
+                "530070000600195000098000060800060003400803001700020006060000280000419005000080079";
+        const std::string HARD_PUZZLE =
+                "000000907000420180000705026100904000050000040000507009920108000034059000507000000";
+        const std::string CLUE17_PUZZLE =
+                "000000010400000000020000000000050407008000300001090000300400200050100000000806000";
+        const std::string WORST_PUZZLE =
+                "400000805030000000000700000020000060000080400000010000000603070500200000104000000";
+        // HARD_PUZZLE with a wrong given which breaks no rule, only the search finds out
+        const std::string UNSOLVABLE_PUZZLE =
+                "000000907000420180000705026100934000050000040000507009920108000034059000507000000";
+
+        /*
+        Loads a puzzle in the 81 character format into the grid.
+
+        @param puzzle The puzzle, zeros are empty cells.
+        @param grid The grid to load the puzzle into.
+        */
+        void loadPuzzle(const std::string& puzzle, Sudoku::Grid& grid)
+        {
+                for (size_t i = 0; i < grid.size(); i++)
+                {
+                        grid.setCell(i, puzzle[i] - '0');
+                }
+        }
+
+        /*
+        Row-major backtracking through the checked accessors, the way the solver used to do it.
+        Serves as the reference for Solver::solve().
+
+        @param grid The grid to solve.
+        @param index The index of the cell to solve.
+
+        @return True if the grid is solved, false otherwise.
+        */
+        bool checkedBacktrack(Sudoku::Grid& grid, size_t index)
+        {
+                while (index < grid.size() && grid.getCell(index) != 0)
+                {
+                        index++;
+                }
+
+                if (index >= grid.size())
+                {
+                        return true;
+                }
+
+                for (int num = 1; num <= 9; num++)
+                {
+                        if (grid.isValidValueToSet(index, num))
+                        {
+                                grid.setCell(index, num);
+
+                                if (checkedBacktrack(grid, index + 1))
+                                {
+                                        return true;
+                                }
+
+                                grid.setCell(index, 0);
+                        }
+                }
+
+                return false;
+        }
+} // namespace
+
+/*
+Solves the puzzle using the checked accessors.
+*/
+static void BM_SolveChecked(benchmark::State& state, const std::string& puzzle)
+{
+        Sudoku::Grid grid;
+
+        for (auto _ : state)
+        {
+                loadPuzzle(puzzle, grid);
+                benchmark::DoNotOptimize(checkedBacktrack(grid, 0));
+        }
+}
+BENCHMARK_CAPTURE(BM_SolveChecked, Easy, EASY_PUZZLE);
+BENCHMARK_CAPTURE(BM_SolveChecked, Hard, HARD_PUZZLE);
+
+/*
+Solves the puzzle using Solver::solve() which uses the unchecked accessors and MRV.
+*/
+static void BM_SolveBacktracking(benchmark::State& state, const std::string& puzzle)
+{
+        Sudoku::Grid grid;
+        Sudoku::Solver solver;
+
+        for (auto _ : state)
+        {
+                loadPuzzle(puzzle, grid);
+                benchmark::DoNotOptimize(solver.solve(grid));
+        }
+}
+BENCHMARK_CAPTURE(BM_SolveBacktracking, Easy, EASY_PUZZLE);
+BENCHMARK_CAPTURE(BM_SolveBacktracking, Hard, HARD_PUZZLE);
+BENCHMARK_CAPTURE(BM_SolveBacktracking, Clue17, CLUE17_PUZZLE);
+BENCHMARK_CAPTURE(BM_SolveBacktracking, Worst, WORST_PUZZLE);
+BENCHMARK_CAPTURE(BM_SolveBacktracking, Unsolvable, UNSOLVABLE_PUZZLE);
+
+/*
+Solves the puzzle using StatsSolver::solve(), the same search as Solver with statistics, to show
+what keeping them costs. The statistics of the last solve are reported as counters.
+*/
+static void BM_SolveStats(benchmark::State& state, const std::string& puzzle)
+{
+        Sudoku::Grid grid;
+        Sudoku::StatsSolver solver;
+
+        for (auto _ : state)
+        {
+                loadPuzzle(puzzle, grid);
+                benchmark::DoNotOptimize(solver.solve(grid));
+        }
+
+        state.counters["nodes"] = solver.getStats().nodes;
+        state.counters["guesses"] = solver.getStats().guesses;
+        state.counters["maxDepth"] = solver.getStats().maxDepth;
+}
+BENCHMARK_CAPTURE(BM_SolveStats, Hard, HARD_PUZZLE);
+BENCHMARK_CAPTURE(BM_SolveStats, Worst, WORST_PUZZLE);
+
+/*
+Solves the puzzle using DlxSolver::solve().
+*/
+static void BM_SolveDlx(benchmark::State& state, const std::string& puzzle)
+{
+        Sudoku::Grid grid;
+        Sudoku::DlxSolver solver;
+
+        for (auto _ : state)
+        {
+                loadPuzzle(puzzle, grid);
+                benchmark::DoNotOptimize(solver.solve(grid));
+        }
+}
+BENCHMARK_CAPTURE(BM_SolveDlx, Easy, EASY_PUZZLE);
+BENCHMARK_CAPTURE(BM_SolveDlx, Hard, HARD_PUZZLE);
+BENCHMARK_CAPTURE(BM_SolveDlx, Clue17, CLUE17_PUZZLE);
+BENCHMARK_CAPTURE(BM_SolveDlx, Worst, WORST_PUZZLE);
+BENCHMARK_CAPTURE(BM_SolveDlx, Unsolvable, UNSOLVABLE_PUZZLE);
+
+/*
+Checks the puzzle for uniqueness, the way the generator does after every removed cell.
+*/
+static void BM_CountSolutions(benchmark::State& state, Sudoku::SolverType type,
+        const std::string& puzzle)
+{
+        Sudoku::Grid grid;
+        std::unique_ptr<Sudoku::SolverStrategy> solver = Sudoku::createSolver(type);
+
+        loadPuzzle(puzzle, grid);
+
+        for (auto _ : state)
+        {
+                benchmark::DoNotOptimize(solver->countSolutions(grid, 2));
+        }
+}
+BENCHMARK_CAPTURE(BM_CountSolutions, BacktrackingEasy, Sudoku::SolverType::BACKTRACKING, EASY_PUZZLE);
+BENCHMARK_CAPTURE(BM_CountSolutions, DlxEasy, Sudoku::SolverType::DANCING_LINKS, EASY_PUZZLE);
+BENCHMARK_CAPTURE(BM_CountSolutions, DlxClue17, Sudoku::SolverType::DANCING_LINKS, CLUE17_PUZZLE);
+
+#endif // !BENCH
@@ -0,0 +1,28 @@
+/*
+Date: 18/10/2026
+
+This file provides benchmarks for the Tracer class.
+*/
+
+#ifndef BENCH
+#error "Tried to compile a benchmark file without the BENCH macro defined. Aborting compilation."
+#else
+
+#include "tracer.hpp"
+#include <benchmark/benchmark.h>
+
+/*
+Records an empty span, what TRACE_SCOPE() adds to every traced function when tracing is on.
+*/
+static void BM_ScopedSpan(benchmark::State& state)
+{
+        for (auto _ : state)
+        {
+                Sudoku::ScopedSpan span("benchmark");
+        }
+
+        state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ScopedSpan);
+
+#endif // !BENCH
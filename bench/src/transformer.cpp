@@ -0,0 +1,53 @@
+/*
+Date: 18/10/2026
+
+This file provides benchmarks for the Transformer class against generating a new grid.
+*/
+
+#ifndef BENCH
+#error "Tried to compile a benchmark file without the BENCH macro defined. Aborting compilation."
+#else
+
+#include "generator.hpp"
+#include "grid.hpp"
+#include "random.hpp"
+#include "transformer.hpp"
+#include <benchmark/benchmark.h>
+
+/*
+Generates a new solved grid with Generator::generate().
+*/
+static void BM_GenerateGrid(benchmark::State& state)
+{
+        Sudoku::Generator generator;
+        Sudoku::Random random(42);
+        Sudoku::Grid grid;
+
+        for (auto _ : state)
+        {
+                generator.generate(grid, random);
+                benchmark::DoNotOptimize(grid);
+        }
+}
+BENCHMARK(BM_GenerateGrid);
+
+/*
+Makes a new solved grid by applying a random transformation to an existing one.
+*/
+static void BM_TransformGrid(benchmark::State& state)
+{
+        Sudoku::Generator generator;
+        Sudoku::Random random(42);
+        Sudoku::Grid grid;
+        Sudoku::Grid result;
+        generator.generate(grid, random);
+
+        for (auto _ : state)
+        {
+                Sudoku::Transformer::apply(Sudoku::Transformer::random(random), grid, result);
+                benchmark::DoNotOptimize(result);
+        }
+}
+BENCHMARK(BM_TransformGrid);
+
+#endif // !BENCH
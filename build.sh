@@ -1,6 +1,6 @@
 #!/bin/bash
 
-# Usage: ./build.sh [dev] [test]
+# Usage: ./build.sh [dev] [test] [bench] [cli] [headless] [trace]
 
 # Exit immediately if a command exits with a non-zero status.
 set -e
@@ -0,0 +1,293 @@
+/*
+Date: 18/10/2026
+
+Description: This file contains the main function of sudoku-cli, the command line solver.
+
+Usage: sudoku-cli [--engine backtracking|dlx|batch] [--threads N] [--output FILE] [--no-timing] [FILE]
+
+Puzzles are read one per line in the 81 character format from FILE or, without one, from stdin.
+Empty lines and lines starting with '#' are skipped. For every other line one line is written:
+
+        <solution or puzzle><TAB><solved|unsolvable|invalid><TAB><microseconds>
+
+The lines are read and solved in blocks, so arbitrarily long inputs are streamed. A summary is
+written to stderr. The exit status is 0 if every puzzle was solved, 1 if some were not and 2 on a
+usage or I/O error.
+*/
+
+#define LOG_SUBSYSTEM DEFAULT
+
+#include "grid.hpp"
+#include "macros.hpp"
+#include "puzzleFormat.hpp"
+#include "puzzleRunner.hpp"
+#include "solver.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+        constexpr size_t BLOCK = 4096;                                          // Lines read and solved at once
+
+        /*
+        Settings given on the command line.
+        */
+        struct Options
+        {
+                Sudoku::Engine engine = Sudoku::Engine::BACKTRACKING;
+                size_t threads = 0;                                             // 0 uses one per hardware thread
+                std::string input;                                              // Empty reads stdin
+                std::string output;                                             // Empty writes stdout
+                bool timing = true;                                             // Whether to write the time column
+        };
+
+        /*
+        Totals over all the blocks.
+        */
+        struct Summary
+        {
+                size_t puzzles = 0;
+                size_t solved = 0;
+                size_t invalid = 0;
+                uint64_t nanoseconds = 0;                                       // Wall time spent solving
+        };
+
+        /*
+        Prints the usage.
+
+        @param stream The stream to print to.
+        */
+        void printUsage(std::ostream& stream)
+        {
+                stream << "Usage: sudoku-cli [options] [file]\n"
+                        << "Solves the puzzles of file (or stdin), one 81 character puzzle per line.\n\n"
+                        << "Options:\n"
+                        << "  -e, --engine NAME   backtracking (default), dlx or batch\n"
+                        << "  -t, --threads N     worker threads, up to 4 per hardware thread, one per\n"
+                        << "                      hardware thread by default\n"
+                        << "  -o, --output FILE   write the solutions to FILE instead of stdout\n"
+                        << "  -n, --no-timing     leave out the time column\n"
+                        << "  -h, --help          print this help\n";
+        }
+
+        /*
+        Parses the command line.
+
+        @param argc The number of arguments.
+        @param argv The arguments.
+        @param options The options to fill.
+
+        @throw std::invalid_argument if an argument is not valid.
+        */
+        void parseOptions(int argc, char** argv, Options& options)
+        {
+                for (int k = 1; k < argc; k++)
+                {
+                        std::string argument = argv[k];
+                        bool hasValue = k + 1 < argc;
+
+                        if ((argument == "-e" || argument == "--engine") && hasValue)
+                        {
+                                if (!Sudoku::PuzzleRunner::parseEngine(argv[++k], options.engine))
+                                {
+                                        throw std::invalid_argument(std::string("Unknown engine: ") + argv[k]);
+                                }
+                        }
+                        else if ((argument == "-t" || argument == "--threads") && hasValue)
+                        {
+                                if (!Sudoku::PuzzleRunner::parseThreads(argv[++k], options.threads))
+                                {
+                                        throw std::invalid_argument(std::string("Invalid number of threads: ") + argv[k]
+                                                + ", must be between 1 and " + std::to_string(Sudoku::PuzzleRunner::maxThreads()));
+                                }
+                        }
+                        else if ((argument == "-o" || argument == "--output") && hasValue)
+                        {
+                                options.output = argv[++k];
+                        }
+                        else if (argument == "-n" || argument == "--no-timing")
+                        {
+                                options.timing = false;
+                        }
+                        else if (argument.empty() || argument[0] != '-' || argument == "-")
+                        {
+                                if (!options.input.empty())
+                                {
+                                        throw std::invalid_argument("Only one input file can be given");
+                                }
+                                options.input = argument == "-" ? "" : argument;
+                        }
+                        else
+                        {
+                                throw std::invalid_argument("Unknown or incomplete option: " + argument);
+                        }
+                }
+        }
+
+        /*
+        Solves one block of lines and writes a line for each.
+
+        @param lines The lines of the block.
+        @param runner The runner solving the puzzles.
+        @param options The options.
+        @param output The stream to write to.
+        @param summary The totals to add the block to.
+        */
+        void solveBlock(const std::vector<std::string>& lines, Sudoku::PuzzleRunner& runner,
+                const Options& options, std::ostream& output, Summary& summary)
+        {
+                std::vector<Sudoku::PackedGrid> grids;
+                std::vector<bool> valid(lines.size());
+                grids.reserve(lines.size());
+
+                for (size_t k = 0; k < lines.size(); k++)
+                {
+                        Sudoku::PackedGrid packed;
+                        valid[k] = Sudoku::PuzzleFormat::parse(lines[k], packed);
+
+                        if (valid[k])
+                        {
+                                grids.push_back(packed);
+                        }
+                }
+
+                std::vector<Sudoku::RunResult> results(grids.size());
+
+                auto start = std::chrono::steady_clock::now();
+                summary.solved += runner.solve(grids.data(), grids.size(), results.data());
+                summary.nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - start).count();
+
+                char time[32];
+                for (size_t k = 0, next = 0; k < lines.size(); k++)
+                {
+                        if (!valid[k])
+                        {
+                                output << lines[k] << "\tinvalid";
+                                output << (options.timing ? "\t0.000\n" : "\n");
+                                summary.invalid++;
+                                continue;
+                        }
+
+                        const Sudoku::RunResult& result = results[next];
+                        bool solved = result.status == Sudoku::SolverStatus::SOLVED;
+
+                        output << (solved ? Sudoku::PuzzleFormat::format(grids[next]) : lines[k].substr(0, 81))
+                                << (solved ? "\tsolved" : "\tunsolvable");
+                        if (options.timing)
+                        {
+                                std::snprintf(time, sizeof(time), "\t%.3f", result.nanoseconds / 1000.0);
+                                output << time;
+                        }
+                        output << '\n';
+                        next++;
+                }
+
+                summary.puzzles += lines.size();
+        }
+} // namespace
+
+int main(int argc, char** argv)
+{
+        #ifdef DEVELOPMENT
+        // The solutions go to stdout, the log would get in their way
+        SET_LOG_LEVEL_OFF();
+        #endif // DEVELOPMENT
+
+        std::ios::sync_with_stdio(false);
+        Options options;
+
+        try
+        {
+                for (int k = 1; k < argc; k++)
+                {
+                        if (std::string(argv[k]) == "-h" || std::string(argv[k]) == "--help")
+                        {
+                                printUsage(std::cout);
+                                return 0;
+                        }
+                }
+
+                parseOptions(argc, argv, options);
+        }
+        catch (const std::exception& exception)
+        {
+                std::cerr << "sudoku-cli: " << exception.what() << "\n\n";
+                printUsage(std::cerr);
+                return 2;
+        }
+
+        std::ifstream file;
+        if (!options.input.empty())
+        {
+                file.open(options.input);
+                if (!file)
+                {
+                        std::cerr << "sudoku-cli: Failed to open " << options.input << '\n';
+                        return 2;
+                }
+        }
+        std::istream& input = options.input.empty() ? std::cin : file;
+
+        std::ofstream outputFile;
+        if (!options.output.empty())
+        {
+                outputFile.open(options.output);
+                if (!outputFile)
+                {
+                        std::cerr << "sudoku-cli: Failed to create " << options.output << '\n';
+                        return 2;
+                }
+        }
+        std::ostream& output = options.output.empty() ? std::cout : outputFile;
+
+        Sudoku::PuzzleRunner runner(options.engine, options.threads);
+        Summary summary;
+        std::vector<std::string> lines;
+        std::string line;
+
+        while (std::getline(input, line))
+        {
+                if (!line.empty() && line.back() == '\r')
+                {
+                        line.pop_back();
+                }
+                if (line.empty() || line[0] == '#')
+                {
+                        continue;
+                }
+
+                lines.push_back(line);
+                if (lines.size() == BLOCK)
+                {
+                        solveBlock(lines, runner, options, output, summary);
+                        lines.clear();
+                }
+        }
+        if (!lines.empty())
+        {
+                solveBlock(lines, runner, options, output, summary);
+        }
+
+        output.flush();
+        if (!output)
+        {
+                std::cerr << "sudoku-cli: Failed to write the solutions\n";
+                return 2;
+        }
+
+        double seconds = summary.nanoseconds / 1e9;
+        std::cerr << "Solved " << summary.solved << " of " << summary.puzzles << " puzzles ("
+                << summary.invalid << " invalid) in " << seconds * 1000.0 << " ms with "
+                << Sudoku::PuzzleRunner::getName(options.engine) << " on " << runner.getThreads()
+                << " threads, " << (seconds > 0 ? summary.solved / seconds : 0.0) << " puzzles/s\n";
+
+        return summary.solved == summary.puzzles ? 0 : 1;
+}
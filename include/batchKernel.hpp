@@ -0,0 +1,168 @@
+/*
+Date: 18/10/2026
+
+Lane parallel propagation kernel used by the BatchSolver.
+
+The kernel works on several puzzles at once. The cells are stored interleaved, cell i of the
+puzzle in lane l is at cells[i * LANES + l] and holds the bit of its value (bit (value - 1),
+zero for an empty cell). Every operation is done on all the lanes together, so the same code
+runs one puzzle per 16-bit lane of a SIMD register.
+
+The vector type V must provide:
+        Type: the register type
+        LANES: the number of 16-bit lanes
+        zero(), set1(value), load(pointer), store(pointer, v)
+        bitOr(a, b), bitAnd(a, b), andNot(a, b) (~a & b), sub(a, b), equal(a, b) (0xFFFF if equal)
+        any(v): true if any lane is not zero
+*/
+
+#ifndef SUDOKU_BATCH_KERNEL_HPP
+#define SUDOKU_BATCH_KERNEL_HPP
+
+#include "gridTables.hpp"
+#include <cstddef>
+#include <cstdint>
+
+// The SIMD kernels are only built for x86 with a GCC compatible compiler
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SUDOKU_BATCH_X86 1
+#endif
+
+namespace Sudoku
+{
+namespace Batch
+{
+        const size_t MAX_LANES = 16;                                            // Widest supported vector (AVX2)
+
+        /*
+        Fills the naked and hidden singles of all the lanes until nothing changes anymore.
+
+        @param cells The interleaved cells of V::LANES puzzles, updated in place.
+        @param dead Set to non-zero for every lane which contains a contradiction, 0 otherwise.
+        */
+        template <class V>
+        void propagateSingles(uint16_t* cells, uint16_t* dead)
+        {
+                using T = typename V::Type;
+                const size_t lanes = V::LANES;
+                const T zero = V::zero();
+                const T one = V::set1(1);
+                const T all = V::set1(0x1FF);
+
+                // Plain arrays, std::array would drop the alignment of the vector type
+                T candidates[81];
+                T houses[27];
+                T deadLanes = zero;
+                T changed = all;
+
+                // House masks of the givens, a value seen twice in a house kills the lane
+                for (T& house : houses)
+                {
+                        house = zero;
+                }
+
+                for (size_t i = 0; i < 81; i++)
+                {
+                        T cell = V::load(cells + i * lanes);
+                        T& row = houses[Tables::ROW[i]];
+                        T& col = houses[9 + Tables::COL[i]];
+                        T& box = houses[18 + Tables::BOX[i]];
+
+                        T duplicate = V::bitOr(V::bitAnd(row, cell),
+                                V::bitOr(V::bitAnd(col, cell), V::bitAnd(box, cell)));
+                        deadLanes = V::bitOr(deadLanes, duplicate);
+
+                        row = V::bitOr(row, cell);
+                        col = V::bitOr(col, cell);
+                        box = V::bitOr(box, cell);
+                }
+
+                // The house masks are kept up to date as cells are filled, so every placement sees
+                // the ones before it. Every pass fills at least one cell of a live lane, so 82 passes
+                // always suffice.
+                for (size_t pass = 0; pass < 82 && V::any(V::andNot(deadLanes, changed)); pass++)
+                {
+                        changed = zero;
+
+                        // Naked singles
+                        for (size_t i = 0; i < 81; i++)
+                        {
+                                T& row = houses[Tables::ROW[i]];
+                                T& col = houses[9 + Tables::COL[i]];
+                                T& box = houses[18 + Tables::BOX[i]];
+
+                                T cell = V::load(cells + i * lanes);
+                                T empty = V::equal(cell, zero);
+                                T candidate = V::bitAnd(V::andNot(V::bitOr(row, V::bitOr(col, box)), all), empty);
+
+                                T none = V::equal(candidate, zero);
+                                T single = V::andNot(none,
+                                        V::equal(V::bitAnd(candidate, V::sub(candidate, one)), zero));
+                                T value = V::bitAnd(candidate, single);
+
+                                deadLanes = V::bitOr(deadLanes, V::bitAnd(empty, none));
+
+                                V::store(cells + i * lanes, V::bitOr(cell, value));
+                                row = V::bitOr(row, value);
+                                col = V::bitOr(col, value);
+                                box = V::bitOr(box, value);
+                                changed = V::bitOr(changed, value);
+
+                                candidates[i] = V::andNot(single, candidate);
+                        }
+
+                        // Hidden singles. The candidates can be stale by the placements above, which
+                        // only makes them too wide, so a value they leave one place for is still forced.
+                        for (size_t house = 0; house < 27; house++)
+                        {
+                                T once = zero;
+                                T twice = zero;
+
+                                for (uint8_t cell : Tables::HOUSES[house])
+                                {
+                                        twice = V::bitOr(twice, V::bitAnd(once, candidates[cell]));
+                                        once = V::bitOr(once, candidates[cell]);
+                                }
+
+                                // Every value must fit somewhere in the house
+                                T covered = V::bitOr(once, houses[house]);
+                                deadLanes = V::bitOr(deadLanes, V::andNot(covered, all));
+
+                                T hidden = V::andNot(V::bitOr(twice, houses[house]), once);
+
+                                for (uint8_t cell : Tables::HOUSES[house])
+                                {
+                                        T& row = houses[Tables::ROW[cell]];
+                                        T& col = houses[9 + Tables::COL[cell]];
+                                        T& box = houses[18 + Tables::BOX[cell]];
+
+                                        T current = V::load(cells + cell * lanes);
+                                        T value = V::bitAnd(V::bitAnd(candidates[cell], hidden),
+                                                V::equal(current, zero));
+
+                                        // Two forced values in one cell, or a forced value which a
+                                        // peer took in the meantime
+                                        T several = V::bitAnd(value, V::sub(value, one));
+                                        T taken = V::bitAnd(value, V::bitOr(row, V::bitOr(col, box)));
+                                        deadLanes = V::bitOr(deadLanes, V::bitOr(several, taken));
+
+                                        V::store(cells + cell * lanes, V::bitOr(current, value));
+                                        row = V::bitOr(row, value);
+                                        col = V::bitOr(col, value);
+                                        box = V::bitOr(box, value);
+                                        changed = V::bitOr(changed, value);
+                                }
+                        }
+                }
+
+                V::store(dead, deadLanes);
+        }
+
+        // Kernel entry points, one per instruction set
+        void propagateScalar(uint16_t* cells, uint16_t* dead);
+        void propagateSse2(uint16_t* cells, uint16_t* dead);
+        void propagateAvx2(uint16_t* cells, uint16_t* dead);
+} // namespace Batch
+} // namespace Sudoku
+
+#endif // !SUDOKU_BATCH_KERNEL_HPP
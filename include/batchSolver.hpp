@@ -0,0 +1,66 @@
+/*
+Date: 18/10/2026
+
+BatchSolver solves many puzzles at once. The puzzles are given as a contiguous array of
+PackedGrids and solved in place.
+
+The puzzles are solved in groups, one puzzle per 16-bit lane of a SIMD register (16 with AVX2,
+8 with SSE2, 1 without SIMD). The naked and hidden singles of the whole group are filled in
+lockstep, see batchKernel.hpp. Most generated puzzles are solved by that alone, the ones which
+still need guessing are finished one by one by the backtracking Solver.
+
+The instruction set is picked at runtime from the features of the CPU.
+*/
+
+#ifndef SUDOKU_BATCH_SOLVER_HPP
+#define SUDOKU_BATCH_SOLVER_HPP
+
+#include "batchKernel.hpp"
+#include "grid.hpp"
+#include "solver.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace Sudoku
+{
+        /*
+        Instruction set used by the BatchSolver kernel.
+        */
+        enum class InstructionSet
+        {
+                SCALAR,
+                SSE2,
+                AVX2
+        };
+
+        class BatchSolver
+        {
+        public: // Methods
+        // Class methods
+                BatchSolver();
+                explicit BatchSolver(InstructionSet instructionSet);
+                ~BatchSolver();
+        // Solver methods
+                size_t solve(PackedGrid* grids, size_t count, SolverStatus* statuses);
+        // Utility methods
+                InstructionSet getInstructionSet() const noexcept;
+                size_t getLanes() const noexcept;
+                static InstructionSet detectInstructionSet() noexcept;
+                static bool isSupported(InstructionSet instructionSet) noexcept;
+        private: // Methods
+        // Solver methods
+                void solveGroup(PackedGrid* grids, size_t count, SolverStatus* statuses);
+                void gather(const PackedGrid* grids, size_t count);
+                void scatter(PackedGrid* grids, size_t count, SolverStatus* statuses);
+        private: // Variables
+                InstructionSet instructionSet;
+                size_t lanes;                                                   // Puzzles solved in lockstep
+                void (*kernel)(uint16_t* cells, uint16_t* dead);                // Propagation kernel for the instruction set
+
+                alignas(32) uint16_t cells[81 * Batch::MAX_LANES];              // Interleaved cells of the group
+                alignas(32) uint16_t dead[Batch::MAX_LANES];                    // Lanes with a contradiction
+                Solver solver;                                                  // Finishes the puzzles which need guessing
+        };
+}
+
+#endif // !SUDOKU_BATCH_SOLVER_HPP
@@ -0,0 +1,83 @@
+/*
+Date: 18/10/2026
+
+Canonicalizer maps a grid to a canonical representative of its class under the symmetries of
+the sudoku grid (see transformer.hpp), so equivalent grids and puzzles can be recognised by
+comparing their canonical forms or their fingerprints.
+
+Solved grids are mapped to the lexicographically minimal grid of their class (reading order,
+row by row). Once the top row is fixed the relabeling makes it 123456789, so the search only
+branches on the transposition, the top two rows and the columns, and the columns are found by a
+pruned search on the second row. The other rows then follow greedily.
+
+A puzzle is mapped through its solution: out of the transformations which map the solution to
+its canonical grid (usually just one) the one giving the smallest puzzle is used. Two puzzles with
+a unique solution are equivalent exactly when their canonical forms are equal.
+*/
+
+#ifndef SUDOKU_CANONICALIZER_HPP
+#define SUDOKU_CANONICALIZER_HPP
+
+#include "grid.hpp"
+#include "solver.hpp"
+#include "transformer.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Sudoku
+{
+        class Canonicalizer
+        {
+        public: // Methods
+        // Class methods
+                Canonicalizer();
+                ~Canonicalizer();
+        // Canonicalizer methods
+                void canonicalize(const Grid& grid, Grid& result);
+                void canonicalize(const Grid& puzzle, const Grid& solution, Grid& result);
+                uint64_t fingerprint(const Grid& grid);
+        // Utility methods
+                static uint64_t hash(const Grid& grid) noexcept;
+        private: // Types
+                /*
+                Partial column permutation built by the search on the second row.
+                */
+                struct Columns
+                {
+                        std::array<int8_t, 9> order;                            // Old column of every new column, -1 if open
+                        std::array<int8_t, 9> position;                         // New column of every old column, -1 if open
+                        std::array<int8_t, 3> stackOf;                          // Old stack of every new stack, -1 if open
+                        std::array<int8_t, 3> stackAt;                          // New stack of every old stack, -1 if open
+                };
+
+                /*
+                Choice of the transposition, top rows and columns which gives the smallest second row.
+                */
+                struct Candidate
+                {
+                        uint8_t transpose;
+                        uint8_t first;                                          // Old top row
+                        uint8_t second;                                         // Old second row
+                        std::array<int8_t, 9> order;                            // Old column of every new column
+                };
+        private: // Methods
+        // Canonicalizer methods
+                void search(const Grid& solution);
+                void searchColumns(size_t column, const Columns& columns);
+                void complete(const Candidate& candidate);
+                void place(Columns& columns, size_t column, size_t old) const noexcept;
+        private: // Variables
+                std::array<std::array<uint8_t, 81>, 2> cells;                   // The solution and its transpose
+                std::array<uint8_t, 9> successor;                               // Column of the top row holding the second row's value
+                std::array<uint8_t, 9> bestRow;                                 // Smallest second row found so far
+                std::vector<Candidate> candidates;                              // Choices giving the smallest second row
+                Candidate current;                                              // Choice being searched
+                std::array<uint8_t, 81> best;                                   // Canonical solution
+                std::vector<Transformation> optimal;                            // Transformations giving the canonical solution
+                Solver solver;                                                  // Solves the puzzles given without a solution
+        };
+}
+
+#endif // !SUDOKU_CANONICALIZER_HPP
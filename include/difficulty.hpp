@@ -0,0 +1,70 @@
+/*
+Date: 18/10/2026
+
+Difficulty levels of the game, defined apart from the GameHandler so the puzzle generation and
+storage code can use them without depending on it.
+*/
+
+#ifndef SUDOKU_DIFFICULTY_HPP
+#define SUDOKU_DIFFICULTY_HPP
+
+#include <array>
+#include <cstddef>
+
+namespace Sudoku
+{
+        /*
+        Number of given based on difficulty:
+        Easy: 34-38
+        Medium: 29-33
+        Hard: 24-28
+        Expert: 19-23
+
+        The value of a difficulty is the number of givens the Digger aims for. It always reaches it
+        up to HARD, while EXPERT usually ends on 22 or 23 givens, see GIVENS_TOLERANCE.
+
+        @note NONE is used as a default value.
+        */
+        enum class Difficulty
+        {
+                NONE = 0,
+                CHEAT = 81,
+                EASY = 36,
+                MEDIUM = 31,
+                HARD = 26,
+                EXPERT = 21
+        };
+
+        // Givens a puzzle may have above the number of its difficulty and stay in its band
+        constexpr size_t GIVENS_TOLERANCE = 2;
+
+        // Difficulties the player can pick, from the easiest
+        constexpr std::array<Difficulty, 4> LEVELS = {
+                Difficulty::EASY,
+                Difficulty::MEDIUM,
+                Difficulty::HARD,
+                Difficulty::EXPERT
+        };
+
+        /*
+        Returns the position of a difficulty in LEVELS.
+
+        @param difficulty The difficulty.
+
+        @return The position, -1 if the player can not pick the difficulty.
+        */
+        constexpr int getLevel(Difficulty difficulty) noexcept
+        {
+                for (size_t level = 0; level < LEVELS.size(); level++)
+                {
+                        if (LEVELS[level] == difficulty)
+                        {
+                                return level;
+                        }
+                }
+
+                return -1;
+        }
+}
+
+#endif // !SUDOKU_DIFFICULTY_HPP
@@ -0,0 +1,97 @@
+/*
+Date: 18/10/2026
+
+Digger turns a solved grid into a puzzle with a unique solution by removing cells.
+
+The cells are removed one at a time (or one symmetric pair at a time) in a random order and the
+puzzle is checked for a unique solution after every removal. A removal which breaks uniqueness is
+undone and the search backtracks depth first until the requested number of givens is reached or
+the budget of uniqueness checks runs out. A cell which could not be removed can never be removed
+later in the same branch either, since removing more cells never makes a puzzle unique again, so
+it is skipped for the whole branch.
+
+If the budget runs out the Digger starts over with a new solved grid, see generate().
+*/
+
+#ifndef SUDOKU_DIGGER_HPP
+#define SUDOKU_DIGGER_HPP
+
+#include "generator.hpp"
+#include "grid.hpp"
+#include "random.hpp"
+#include "solver.hpp"
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Sudoku
+{
+        /*
+        Pattern of the removed cells.
+
+        NONE: Cells are removed one at a time.
+        ROTATIONAL: Cells are removed together with their 180 degree rotation.
+        MIRROR: Cells are removed together with their mirror image across the middle column.
+        */
+        enum class Symmetry
+        {
+                NONE,
+                ROTATIONAL,
+                MIRROR
+        };
+
+        class Digger
+        {
+        public: // Methods
+        // Class methods
+                Digger();
+                ~Digger();
+        // Digger methods
+                bool dig(Grid& grid, size_t givens, Random& random, Symmetry symmetry = Symmetry::NONE);
+                bool generate(Grid& puzzle, Grid& solution, size_t givens, Random& random,
+                        Symmetry symmetry = Symmetry::NONE);
+        // Setters
+                void setBudget(size_t checks) noexcept;
+                void setAttempts(size_t attempts) noexcept;
+                void setTolerance(size_t givens) noexcept;
+        // Getters
+                size_t getSolves() const noexcept;
+        private: // Methods
+        // Digger methods
+                void makeUnits(Symmetry symmetry, Random& random);
+                bool search(Grid& grid, size_t unit, size_t givens, std::bitset<81> failed);
+                size_t lowerBound(size_t unit, const std::bitset<81>& failed) const noexcept;
+                bool isAvoidable() noexcept;
+                bool isUnique(Grid& grid, size_t unit);
+                void learn(const Grid& other);
+        private: // Variables
+                static constexpr size_t DEFAULT_BUDGET = 120;                   // Uniqueness checks per solved grid
+                static constexpr size_t DEFAULT_ATTEMPTS = 16;                  // Solved grids tried by generate()
+                static constexpr size_t REJECTIONS_PER_CHECK = 64;              // Removals rejected by a known set per check
+                static constexpr size_t MAX_UNAVOIDABLE = 512;                  // Unavoidable sets remembered per solved grid
+
+                Generator generator;
+                Solver solver;                                                  // Counts the solutions after every removal
+                size_t budget = DEFAULT_BUDGET;
+                size_t attempts = DEFAULT_ATTEMPTS;
+                size_t tolerance = 0;                                           // Givens above the target generate() accepts
+                size_t solves = 0;                                              // Solver calls since generate() started
+
+                // Search state
+                std::array<std::array<uint8_t, 2>, 81> units;                   // Cells removed together
+                std::array<uint8_t, 81> unitSizes;                              // Number of cells in every unit (1 or 2)
+                size_t unitCount = 0;
+                size_t target = 0;                                              // Number of givens to reach
+                size_t checks = 0;                                              // Uniqueness checks done so far
+                size_t rejections = 0;                                          // Removals rejected by a known set
+                Grid solution;                                                  // Solution of the puzzle being dug
+                std::bitset<81> givenMask;                                      // Givens of the puzzle being dug
+                std::vector<std::bitset<81>> unavoidable;                       // Cell sets which need a given
+                Grid best;                                                      // Puzzle with the fewest givens seen
+                size_t bestGivens = 0;
+        };
+}
+
+#endif // !SUDOKU_DIGGER_HPP
@@ -0,0 +1,76 @@
+/*
+Date: 18/10/2026
+
+DlxSolver solves a sudoku grid as an exact cover problem using Knuth's Algorithm X with
+Dancing Links.
+
+The constraint matrix has 729 rows (one for every cell and value pair) and 324 columns:
+          0 - 80: cell i is filled
+         81 - 161: row r contains value v
+        162 - 242: column c contains value v
+        243 - 323: box b contains value v
+Every row has exactly four nodes. All the nodes live in a single pool which is built once in
+the constructor, a solve only relinks them and restores the matrix before it returns.
+*/
+
+#ifndef SUDOKU_DLX_SOLVER_HPP
+#define SUDOKU_DLX_SOLVER_HPP
+
+#include "grid.hpp"
+#include "solverStrategy.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Sudoku
+{
+        class DlxSolver : public SolverStrategy
+        {
+        public: // Methods
+        // Class methods
+                DlxSolver();
+                ~DlxSolver() override;
+        // Solver methods
+                bool solve(Grid& grid) override;
+                int countSolutions(const Grid& grid, int limit = 2) override;
+        // Getters
+                uint64_t getNodes() const noexcept;
+        private: // Methods
+        // Matrix methods
+                void build();
+                void cover(int column) noexcept;
+                void uncover(int column) noexcept;
+                bool selectRow(int row) noexcept;
+                void deselectRow(int row) noexcept;
+                bool selectGivens(const Grid& grid, size_t& givenCount) noexcept;
+                void deselectGivens(size_t givenCount) noexcept;
+        // Search methods
+                bool search(Grid& grid);
+                int count(int limit);
+                int chooseColumn() const noexcept;
+        private: // Variables
+                static constexpr int ROWS = 729;                                // Cell and value pairs
+                static constexpr int COLUMNS = 324;                             // Constraints
+                static constexpr int ROOT = 0;                                  // Index of the root header
+                static constexpr int NODES = 1 + COLUMNS + ROWS * 4;            // Root, column headers and row nodes
+
+                struct Node
+                {
+                        int left;
+                        int right;
+                        int up;
+                        int down;
+                        int column;                                             // Column of the node, the header is node (column + 1)
+                        int row;                                                // Matrix row, -1 for headers
+                };
+
+                std::vector<Node> nodes;                                        // Node pool, index 0 is the root
+                std::array<int, COLUMNS> sizes;                                 // Number of nodes in every column
+                std::array<bool, COLUMNS> covered;                              // Whether the column is covered
+                std::array<int, ROWS> rowStart;                                 // First node of every matrix row
+                std::array<int, 81> givens;                                     // Matrix rows selected for the given cells
+                uint64_t searchNodes = 0;                                       // Search calls of the last solve or count
+        };
+}
+
+#endif // !SUDOKU_DLX_SOLVER_HPP
@@ -7,33 +7,20 @@ Game handler makes the connection between the GUI and the game logic.
 #ifndef GAME_HANDLER_HPP
 #define GAME_HANDLER_HPP
 
-#include "generator.hpp"
+#include "difficulty.hpp"
+#include "digger.hpp"
 #include "grid.hpp"
+#include "pregenerator.hpp"
+#include "puzzleBank.hpp"
+#include "random.hpp"
 #include "solver.hpp"
 #include <bitset>
 #include <chrono>
+#include <cstdint>
+#include <string>
 
 namespace Sudoku
 {
-        /*
-        Number of given based on difficulty:
-        Easy: 34-38
-        Medium: 29-33
-        Hard: 24-28
-        Expert: 19-23
-
-        @note NONE is used as a default value.
-        */
-        enum class Difficulty
-        {
-                NONE = 0,
-                CHEAT = 81,
-                EASY = 36,
-                MEDIUM = 31,
-                HARD = 26,
-                EXPERT = 21
-        };
-
         class GameHandler
         {
         public: // Methods
@@ -42,6 +29,10 @@ namespace Sudoku
                 ~GameHandler();
         // Game handler methods
                 void newGame(Difficulty difficulty);
+                void newGame(Difficulty difficulty, uint64_t seed);
+                bool openBank(const std::string& path);
+                void startPregenerating();
+                void stopPregenerating() noexcept;
                 bool checkUserInput(int index, int value);
                 void solve(int cells);
         // Getters
@@ -52,6 +43,7 @@ namespace Sudoku
                 bool checkWin() const;
         private: // Methods
         // Game handler methods
+                void startGame(Difficulty difficulty, uint64_t seed);
                 void updateScore();
         public: // Variables
                 int score = 0;                                                  // The score of the player
@@ -65,11 +57,17 @@ namespace Sudoku
                 int hintsUsed = 0;                                              // Number of hints used
                 std::chrono::seconds time;                                      // Time taken to solve the grid (in seconds)
                 bool cheat = false;                                             // If the player is cheating
+                uint64_t seed = 0;                                              // Seed of the game, replays it with newGame()
         private: // Variables
                 Grid grid;                                                      // What the player sees
                 Grid solved;                                                    // The solved grid
-                Generator generator;                                            // Generates a new sudoku grid
+                static constexpr const char* BANK_PATH = "assets/puzzles.bank"; // Bank opened by the constructor if it exists
+
+                PuzzleBank bank;                                                // Pregenerated puzzles, picked first
+                Digger digger;                                                  // Generates a puzzle the bank does not have
+                Pregenerator pregenerator;                                      // Generates puzzles in the background
                 Solver solver;                                                  // Solves the sudoku grid
+                Random random;                                                  // Seeded per game, used for generating and hints
         };
 }
 
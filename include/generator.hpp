@@ -8,7 +8,9 @@ Generator is class which generates a new sudoku grid.
 #define SUDOKU_GENERATOR_HPP
 
 #include "grid.hpp"
+#include "random.hpp"
 #include "solver.hpp"
+#include <cstddef>
 
 namespace Sudoku
 {
@@ -20,9 +22,14 @@ namespace Sudoku
                 ~Generator();
         // Generator methods
                 void generate(Grid& grid);
+                void generate(Grid& grid, Random& random);
+        // Getters
+                size_t getSolves() const noexcept;
         private: // Methods
         // Generator methods
-                void randomlyFillDiagonalBoxes(Grid& grid);
+                void randomlyFillDiagonalBoxes(Grid& grid, Random& random);
+        private: // Variables
+                size_t solves = 0;                                              // Solver calls of the last generate()
         };
 }
 
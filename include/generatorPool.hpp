@@ -0,0 +1,55 @@
+/*
+Date: 18/10/2026
+
+GeneratorPool generates many puzzles in parallel on a work stealing ThreadPool.
+
+Every puzzle gets its own random number generator seeded from the master seed and the index of
+the puzzle. The output therefore only depends on the master seed, not on the number of threads
+or on which thread generated which puzzle, and any puzzle can be generated again on its own from
+its seed.
+*/
+
+#ifndef SUDOKU_GENERATOR_POOL_HPP
+#define SUDOKU_GENERATOR_POOL_HPP
+
+#include "difficulty.hpp"
+#include "grid.hpp"
+#include "threadPool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Sudoku
+{
+        /*
+        A generated puzzle together with its solution.
+
+        @note The givens of the puzzle are marked as fixed.
+        */
+        struct GeneratedPuzzle
+        {
+                PackedGrid puzzle;                                              // The puzzle, zeros are empty cells
+                PackedGrid solution;                                            // The filled grid the puzzle was made from
+                uint64_t seed;                                                  // Generates the same puzzle again
+        };
+
+        class GeneratorPool
+        {
+        public: // Methods
+        // Class methods
+                explicit GeneratorPool(size_t threads = 0);
+                ~GeneratorPool();
+        // Generator methods
+                std::vector<GeneratedPuzzle> generate(size_t count, Difficulty difficulty,
+                        uint64_t masterSeed);
+                static GeneratedPuzzle generateOne(Difficulty difficulty, uint64_t seed);
+        // Utility methods
+                size_t getThreads() const noexcept;
+                static uint64_t puzzleSeed(uint64_t masterSeed, size_t index) noexcept;
+        private: // Variables
+                static constexpr size_t CHUNK = 64;                             // Puzzles generated by one task
+                ThreadPool pool;
+        };
+}
+
+#endif // !SUDOKU_GENERATOR_POOL_HPP
@@ -0,0 +1,103 @@
+/*
+Date: 18/10/2026
+
+Grader rates how hard a puzzle is for a human by solving it with human techniques only.
+
+The techniques are tried from the easiest to the hardest and after every step the grader starts
+over from the easiest one, the way a person would. The hardest technique needed is the grade of
+the puzzle, the sum of the weights of all the steps is its score. A puzzle the techniques can not
+finish needs guessing. How much guessing is measured by finishing it with a StatsSolver, which
+ranks the puzzles graded GUESS among themselves.
+
+The weights follow the ratings of Sudoku Explainer (times ten), which also fixes the order of the
+techniques. The chains are X-Chains on a single value and XY-Chains through cells with two
+candidates. Nothing beyond them is implemented (no uniqueness techniques, no forcing chains or
+nets), a puzzle which needs more is graded GUESS.
+*/
+
+#ifndef SUDOKU_GRADER_HPP
+#define SUDOKU_GRADER_HPP
+
+#include "grid.hpp"
+#include "solver.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Sudoku
+{
+        /*
+        Human solving techniques, from the easiest to the hardest.
+
+        @note NONE is the grade of a solved grid, GUESS the grade of a puzzle the techniques can
+        not finish.
+        */
+        enum class Technique
+        {
+                NONE,
+                HIDDEN_SINGLE,
+                NAKED_SINGLE,
+                POINTING,
+                BOX_LINE,
+                NAKED_PAIR,
+                X_WING,
+                HIDDEN_PAIR,
+                NAKED_TRIPLE,
+                SWORDFISH,
+                HIDDEN_TRIPLE,
+                XY_WING,
+                X_CHAIN,
+                XY_CHAIN,
+                GUESS
+        };
+
+        /*
+        Result of grading a puzzle.
+        */
+        struct Grade
+        {
+                Technique hardest = Technique::NONE;                            // Hardest technique needed
+                int score = 0;                                                  // Sum of the weights of all the steps
+                int steps = 0;                                                  // Number of techniques applied
+                bool solved = false;                                            // If the techniques solved the puzzle
+                uint64_t guesses = 0;                                           // Guesses the solver needed to finish the puzzle
+        };
+
+        class Grader
+        {
+        public: // Methods
+        // Class methods
+                Grader();
+                ~Grader();
+        // Grader methods
+                Grade grade(const Grid& grid);
+        // Getters
+                void getGrid(Grid& grid) const;
+        // Utility methods
+                static int getWeight(Technique technique) noexcept;
+                static const char* getName(Technique technique) noexcept;
+        private: // Methods
+        // Grader methods
+                Technique step();
+                void place(size_t cell, int value) noexcept;
+                bool eliminate(size_t cell, uint16_t mask) noexcept;
+        // Techniques
+                bool hiddenSingle() noexcept;
+                bool nakedSingle() noexcept;
+                bool pointing() noexcept;
+                bool boxLine() noexcept;
+                bool nakedSubset(int size) noexcept;
+                bool hiddenSubset(int size) noexcept;
+                bool fish(int size) noexcept;
+                bool xyWing() noexcept;
+                bool xChain() noexcept;
+                bool xyChain() noexcept;
+        private: // Variables
+                std::array<uint8_t, 81> values;                                 // Value of every cell, 0 if empty
+                std::array<uint16_t, 81> candidates;                            // Candidates of every empty cell
+                size_t empty = 0;                                               // Number of empty cells
+                StatsSolver solver;                                             // Finishes the puzzles the techniques can not
+        };
+}
+
+#endif // !SUDOKU_GRADER_HPP
@@ -3,7 +3,7 @@ Date: 09/11/2024
 
 Grid class stores the sudoku grid and provides methods to manipulate it.
 
-The sudoku grid is stored as a 1D array of 81 integers. The grid is divided into 9 rows, 9 columns, and 9 boxes.
+The sudoku grid is stored as a 1D array of 81 bytes. The grid is divided into 9 rows, 9 columns, and 9 boxes.
 Here is visual representation of the grid:
          0  1  2 | 3  4  5 | 6  7  8
          9 10 11 |12 13 14 |15 16 17
@@ -20,16 +20,82 @@ And this is how the boxes are numbered:
         0  1  2
         3  4  5
         6  7  8
+
+Every cell byte holds the value in its low nibble and the fixed flag in bit 4. For bulk storage
+the grid can be packed into a PackedGrid which keeps two cells per byte and fits a single cache line.
+
+Next to the cells the grid keeps a 9-bit occupancy mask for every row, column and box which
+is updated on every write. Bit (value - 1) of a mask is set if the house contains value, so the
+values which can still be placed into a cell are just the inverse of the three masks OR-ed together.
+
+The grid also keeps a Zobrist hash of its values: the XOR of a fixed random key for the value of
+every cell (see gridTables.hpp). A write XORs out the key of the old value and XORs in the key of
+the new one, so hash() is always current without rehashing the 81 cells. Equal values give equal
+hashes whatever order they were written in, the fixed flags are not hashed. The incremental hash is
+kept when GRID_HASH is defined (the GRID_HASH CMake option, on by default), otherwise hash() falls
+back to hashing the 81 cells and the writes stay as cheap as before.
 */
 
 #ifndef GRID_HPP
 #define GRID_HPP
 
+#include "gridTables.hpp"
+#include "random.hpp"
 #include <array>
 #include <bitset>
+#include <cstdint>
 
 namespace Sudoku
 {
+        const uint16_t ALL_CANDIDATES = 0x1FF;                                  // Mask with all values [1, 9] set
+
+        /*
+        Returns the number of values in a candidate mask.
+
+        @param mask The candidate mask.
+
+        @return The number of set bits.
+        */
+        inline int popCount(uint16_t mask) noexcept
+        {
+                #if defined(__GNUC__) || defined(__clang__)
+                return __builtin_popcount(mask);
+                #else
+                return std::bitset<16>(mask).count();
+                #endif
+        }
+
+        /*
+        Returns the lowest value in a candidate mask.
+
+        @param mask The candidate mask. Must not be zero.
+
+        @return The value in the range [1, 9] of the lowest set bit.
+        */
+        inline int lowestValue(uint16_t mask) noexcept
+        {
+                #if defined(__GNUC__) || defined(__clang__)
+                return __builtin_ctz(mask) + 1;
+                #else
+                int value = 1;
+                while (!(mask & 1))
+                {
+                        mask >>= 1;
+                        value++;
+                }
+                return value;
+                #endif
+        }
+
+        /*
+        Compact form of the grid used to keep large numbers of grids in memory.
+        */
+        struct PackedGrid
+        {
+                std::array<uint8_t, 41> cells;                                  // Two cells per byte, the even cell in the low nibble
+                std::array<uint8_t, 11> fixed;                                  // Bit (i % 8) of byte (i / 8) is set if cell i is fixed
+        };
+
         class Grid
         {
         public: // Methods
@@ -44,6 +110,7 @@ namespace Sudoku
                 void getBox(size_t box, std::array<int, 9>& boxArray) const;
         // Setters
                 void setZero(size_t count);
+                void setZero(size_t count, Random& random);
                 void setCell(size_t i, int value);
                 void setRow(size_t row, const std::array<int, 9>& rowArray);
                 void setCol(size_t col, const std::array<int, 9>& colArray);
@@ -55,20 +122,218 @@ namespace Sudoku
                 size_t convertIndex(size_t row, size_t col) const;
                 void print() const noexcept;
                 int count(int value) const;
+                uint64_t hash() const noexcept;
         // Checkers
                 bool isSolved() const noexcept;
+                bool isValid() const noexcept;
                 bool contains(int value) const noexcept;
                 bool areValidValues(const std::array<int, 9>& array) const noexcept;
-                bool isValidValueToSet(size_t i, int value);
+                bool isValidValueToSet(size_t i, int value) const;
+        // Candidates
+                uint16_t candidates(size_t i) const;
+                int candidateCount(size_t i) const;
+        // Fixed cells
+                bool isFixed(size_t i) const;
+                void setFixed(size_t i, bool fixed = true);
+                void fixGivens() noexcept;
+        // Packing
+                void pack(PackedGrid& packed) const noexcept;
+                void unpack(const PackedGrid& packed);
+        // Unchecked access
+                int getCellUnchecked(size_t i) const noexcept;
+                void setCellUnchecked(size_t i, int value) noexcept;
+                uint16_t candidatesUnchecked(size_t i) const noexcept;
+                uint16_t houseMaskUnchecked(size_t house) const noexcept;
         // Utility checkers
                 bool checkCellIndex(size_t i) const noexcept;
                 bool checkCellIndex(size_t row, size_t col) const noexcept;
                 bool checkIndex(size_t i) const noexcept;
+                bool checkValue(int value) const noexcept;
+                bool checkValues(const std::array<int, 9>& array) const noexcept;
+        private: // Methods
+        // Cells
+                int read(size_t i) const noexcept;
+                void write(size_t i, int value) noexcept;
+                void writeExact(size_t i, int value) noexcept;
+        // Masks
+                void updateMasks(size_t i, int oldValue, int newValue) noexcept;
+                void rebuildMasks() noexcept;
         private: // Variables
-                std::array<int, 81> grid;                                               // Stores the sudoku grid as a 1D array
-        public: // Variables
-                std::bitset<81> fixed;                                                  // Stores whether a cell is fixed
+                static constexpr uint8_t VALUE_BITS = 0x0F;                             // Bits of a cell holding the value
+                static constexpr uint8_t FIXED_BIT = 0x10;                              // Bit of a cell holding the fixed flag
+                std::array<uint8_t, 81> grid;                                           // Stores the sudoku grid as a 1D array
+                std::array<uint16_t, 9> rowMasks;                                       // Bit (value - 1) is set if the row contains value
+                std::array<uint16_t, 9> colMasks;                                       // Bit (value - 1) is set if the column contains value
+                std::array<uint16_t, 9> boxMasks;                                       // Bit (value - 1) is set if the box contains value
+                #ifdef GRID_HASH
+                uint64_t zobrist;                                                       // XOR of the Zobrist keys of the values
+                #endif
         };
+
+// Unchecked access
+        /*
+        The unchecked accessors skip the bounds and value checks, the logging and the function call
+        so they can be used in the hot loops of the solver and the generator. The caller is
+        responsible for passing an index in [0, 80] and a value in [0, 9] and for keeping the
+        grid valid, the checked accessors should be used for anything coming from the user.
+        */
+
+        /*
+        Returns the value of the cell at index i.
+
+        @param i The index of the cell. Must be in the range [0, 80].
+
+        @return The value of the cell.
+        */
+        inline int Grid::getCellUnchecked(size_t i) const noexcept
+        {
+                return read(i);
+        }
+
+        /*
+        Sets the value of the cell at index i.
+
+        @param i The index of the cell. Must be in the range [0, 80].
+        @param value The value to set the cell to. Must be in the range [0, 9].
+        */
+        inline void Grid::setCellUnchecked(size_t i, int value) noexcept
+        {
+                write(i, value);
+        }
+
+        /*
+        Returns the values which can be placed into the cell at index i.
+
+        @param i The index of the cell. Must be in the range [0, 80].
+
+        @return Bitmask where bit (value - 1) is set if value can be placed into the cell. A filled
+                cell keeps its own value unless a peer holds it too.
+        */
+        inline uint16_t Grid::candidatesUnchecked(size_t i) const noexcept
+        {
+                uint16_t used = rowMasks[Tables::ROW[i]] | colMasks[Tables::COL[i]]
+                        | boxMasks[Tables::BOX[i]];
+
+                // The cell's own value does not block itself, the masks can not tell if a peer holds it
+                int value = read(i);
+                if (value != 0)
+                {
+                        bool shared = false;
+                        for (uint8_t peer : Tables::PEERS[i])
+                        {
+                                shared |= read(peer) == value;
+                        }
+
+                        if (!shared)
+                        {
+                                used &= ~(1 << (value - 1));
+                        }
+                }
+
+                return ~used & ALL_CANDIDATES;
+        }
+
+        /*
+        Returns the values present in a house.
+
+        @param house The index of the house. Must be in the range [0, 26], see gridTables.hpp.
+
+        @return Bitmask where bit (value - 1) is set if the house contains value.
+        */
+        inline uint16_t Grid::houseMaskUnchecked(size_t house) const noexcept
+        {
+                if (house < 9)
+                {
+                        return rowMasks[house];
+                }
+
+                return house < 18 ? colMasks[house - 9] : boxMasks[house - 18];
+        }
+// Utility
+        /*
+        Returns the Zobrist hash of the values, kept up to date by every write.
+
+        @return The hash, zero for the empty grid.
+
+        @note Without GRID_HASH the hash is computed from the cells on every call.
+        */
+        inline uint64_t Grid::hash() const noexcept
+        {
+                #ifdef GRID_HASH
+                return zobrist;
+                #else
+                uint64_t zobrist = 0;
+
+                for (size_t i = 0; i < grid.size(); i++)
+                {
+                        zobrist ^= Tables::ZOBRIST[i][read(i)];
+                }
+
+                return zobrist;
+                #endif
+        }
+// Cells
+        /*
+        Returns the value of the cell at index i without the fixed flag.
+
+        @param i The index of the cell. Must be in the range [0, 80].
+
+        @return The value of the cell.
+        */
+        inline int Grid::read(size_t i) const noexcept
+        {
+                return grid[i] & VALUE_BITS;
+        }
+
+        /*
+        Writes a value into the cell at index i and updates the masks and the hash. The fixed flag
+        is kept.
+
+        @param i The index of the cell. Must be in the range [0, 80].
+        @param value The value to write. Must be in the range [0, 9].
+        */
+        inline void Grid::write(size_t i, int value) noexcept
+        {
+                int oldValue = read(i);
+
+                updateMasks(i, oldValue, value);
+                #ifdef GRID_HASH
+                zobrist ^= Tables::ZOBRIST[i][oldValue] ^ Tables::ZOBRIST[i][value];
+                #endif
+                grid[i] = (grid[i] & FIXED_BIT) | value;
+        }
+// Masks
+        /*
+        Updates the row, column and box masks of the cell at index i after its value changes.
+
+        @param i The index of the cell. Must be in the range [0, 80].
+        @param oldValue The value the cell held before.
+        @param newValue The value the cell holds now.
+
+        @note Zero is not tracked by the masks.
+        */
+        inline void Grid::updateMasks(size_t i, int oldValue, int newValue) noexcept
+        {
+                size_t row = Tables::ROW[i];
+                size_t col = Tables::COL[i];
+                size_t box = Tables::BOX[i];
+
+                if (oldValue != 0)
+                {
+                        uint16_t bit = 1 << (oldValue - 1);
+                        rowMasks[row] &= ~bit;
+                        colMasks[col] &= ~bit;
+                        boxMasks[box] &= ~bit;
+                }
+
+                if (newValue != 0)
+                {
+                        uint16_t bit = 1 << (newValue - 1);
+                        rowMasks[row] |= bit;
+                        colMasks[col] |= bit;
+                        boxMasks[box] |= bit;
+                }
+        }
 } // namespace Sudoku
 
 #endif // !GRID_HPP
\ No newline at end of file
@@ -0,0 +1,152 @@
+/*
+Date: 18/10/2026
+
+Precomputed index tables for the sudoku grid. They are generated at compile time and let hot
+loops (solver, generator) walk rows, columns, boxes and peers without any index arithmetic
+or bounds checks. The Zobrist keys the grid hashes its values with live here as well.
+
+Houses are numbered as follows:
+        0 - 8: rows
+        9 - 17: columns
+        18 - 26: boxes
+*/
+
+#ifndef GRID_TABLES_HPP
+#define GRID_TABLES_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Sudoku
+{
+namespace Tables
+{
+        /*
+        Returns the row of every cell.
+        */
+        constexpr std::array<uint8_t, 81> makeRows()
+        {
+                std::array<uint8_t, 81> rows{};
+
+                for (size_t i = 0; i < 81; i++)
+                {
+                        rows[i] = i / 9;
+                }
+
+                return rows;
+        }
+
+        /*
+        Returns the column of every cell.
+        */
+        constexpr std::array<uint8_t, 81> makeCols()
+        {
+                std::array<uint8_t, 81> cols{};
+
+                for (size_t i = 0; i < 81; i++)
+                {
+                        cols[i] = i % 9;
+                }
+
+                return cols;
+        }
+
+        /*
+        Returns the box of every cell.
+        */
+        constexpr std::array<uint8_t, 81> makeBoxes()
+        {
+                std::array<uint8_t, 81> boxes{};
+
+                for (size_t i = 0; i < 81; i++)
+                {
+                        boxes[i] = (i / 27) * 3 + (i % 9) / 3;
+                }
+
+                return boxes;
+        }
+
+        /*
+        Returns the cell indices of every house.
+        */
+        constexpr std::array<std::array<uint8_t, 9>, 27> makeHouses()
+        {
+                std::array<std::array<uint8_t, 9>, 27> houses{};
+
+                for (size_t i = 0; i < 9; i++)
+                {
+                        size_t boxStart = (i / 3) * 27 + (i % 3) * 3;
+
+                        for (size_t j = 0; j < 9; j++)
+                        {
+                                houses[i][j] = i * 9 + j;
+                                houses[9 + i][j] = j * 9 + i;
+                                houses[18 + i][j] = boxStart + (j / 3) * 9 + j % 3;
+                        }
+                }
+
+                return houses;
+        }
+
+        /*
+        Returns the 20 peers (cells sharing a row, column or box) of every cell.
+        */
+        constexpr std::array<std::array<uint8_t, 20>, 81> makePeers()
+        {
+                std::array<std::array<uint8_t, 20>, 81> peers{};
+
+                for (size_t i = 0; i < 81; i++)
+                {
+                        size_t count = 0;
+
+                        for (size_t j = 0; j < 81; j++)
+                        {
+                                bool sameRow = i / 9 == j / 9;
+                                bool sameCol = i % 9 == j % 9;
+                                bool sameBox = (i / 27) == (j / 27) && (i % 9) / 3 == (j % 9) / 3;
+
+                                if (i != j && (sameRow || sameCol || sameBox))
+                                {
+                                        peers[i][count++] = j;
+                                }
+                        }
+                }
+
+                return peers;
+        }
+
+        /*
+        Returns the Zobrist key of every value of every cell, drawn from a SplitMix64 sequence
+        with a fixed seed. The key of an empty cell is zero, so the empty grid hashes to zero.
+        */
+        constexpr std::array<std::array<uint64_t, 10>, 81> makeZobrist()
+        {
+                std::array<std::array<uint64_t, 10>, 81> keys{};
+                uint64_t state = 0x5D0C0B15ULL;
+
+                for (size_t i = 0; i < 81; i++)
+                {
+                        for (size_t value = 1; value < 10; value++)
+                        {
+                                state += 0x9E3779B97F4A7C15ULL;
+                                uint64_t key = state;
+                                key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                                key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+                                keys[i][value] = key ^ (key >> 31);
+                        }
+                }
+
+                return keys;
+        }
+
+        constexpr std::array<uint8_t, 81> ROW = makeRows();                     // Row of every cell
+        constexpr std::array<uint8_t, 81> COL = makeCols();                     // Column of every cell
+        constexpr std::array<uint8_t, 81> BOX = makeBoxes();                    // Box of every cell
+        constexpr std::array<std::array<uint8_t, 9>, 27> HOUSES = makeHouses(); // Cells of every house
+        constexpr std::array<std::array<uint8_t, 20>, 81> PEERS = makePeers();  // Peers of every cell
+        constexpr std::array<std::array<uint64_t, 10>, 81> ZOBRIST = makeZobrist(); // Hash key of every value of every cell
+} // namespace Tables
+} // namespace Sudoku
+
+#endif // !GRID_TABLES_HPP
@@ -3,24 +3,83 @@ Date: 09/11/2024
 
 Description: This file contains global variables, macros etc. that are used throughout the program.
 
-Notes: x
+Notes: Every log statement belongs to the subsystem of its file, set by defining LOG_SUBSYSTEM
+before the includes:
+        GRID: the grid and the puzzle format.
+        SOLVER: the solvers, the batch solver, the runner and the grader.
+        GENERATOR: the generators, the pool, the bank, the transformations.
+        GUI: the window, the scenes, the sounds, the commands, the game handler.
+        CORE: the thread pool and the tracer, shared by the other subsystems.
+        DEFAULT: the entry points and the signal handler, and any file which sets no subsystem.
+A subsystem logs nothing below its compile time level LOG_LEVEL_<subsystem> (the CMake options of
+the same name). Statements below it are discarded by `if constexpr`, so they cost nothing, not
+even the runtime level check of spdlog. The runtime level set by SET_LOG_LEVEL_*() filters what
+is left.
 */
 
 #ifndef MACROS_HPP
 #define MACROS_HPP
 
+// Log levels, in the order of spdlog's
+#define LOG_LEVEL_TRACE 0
+#define LOG_LEVEL_DEBUG 1
+#define LOG_LEVEL_INFO 2
+#define LOG_LEVEL_WARN 3
+#define LOG_LEVEL_ERROR 4
+#define LOG_LEVEL_CRITICAL 5
+#define LOG_LEVEL_OFF 6
+
+// Compile time level of every subsystem
+#ifndef LOG_LEVEL_GRID
+#define LOG_LEVEL_GRID LOG_LEVEL_TRACE
+#endif
+#ifndef LOG_LEVEL_SOLVER
+#define LOG_LEVEL_SOLVER LOG_LEVEL_TRACE
+#endif
+#ifndef LOG_LEVEL_GENERATOR
+#define LOG_LEVEL_GENERATOR LOG_LEVEL_TRACE
+#endif
+#ifndef LOG_LEVEL_GUI
+#define LOG_LEVEL_GUI LOG_LEVEL_TRACE
+#endif
+#ifndef LOG_LEVEL_CORE
+#define LOG_LEVEL_CORE LOG_LEVEL_TRACE
+#endif
+#ifndef LOG_LEVEL_DEFAULT
+#define LOG_LEVEL_DEFAULT LOG_LEVEL_TRACE
+#endif
+
+// Subsystem of the files which do not set one
+#ifndef LOG_SUBSYSTEM
+#define LOG_SUBSYSTEM DEFAULT
+#endif
+
+// Compile time level of the subsystem of the file, expanded where the log statement is
+#define LOG_CONCAT_(a, b) a##b
+#define LOG_CONCAT(a, b) LOG_CONCAT_(a, b)
+#define LOG_SUBSYSTEM_LEVEL LOG_CONCAT(LOG_LEVEL_, LOG_SUBSYSTEM)
+
 #ifdef DEVELOPMENT
 // Include the spdlog library for logging
 #include <spdlog/spdlog.h>
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
-// Macro for development logging
-#define LOG_TRACE(...) spdlog::trace(__VA_ARGS__)
-#define LOG_DEBUG(...) spdlog::debug(__VA_ARGS__)
-#define LOG_INFO(...) spdlog::info(__VA_ARGS__)
-#define LOG_WARN(...) spdlog::warn(__VA_ARGS__)
-#define LOG_ERROR(...) spdlog::error(__VA_ARGS__)
-#define LOG_CRITICAL(...) spdlog::critical(__VA_ARGS__)
+// Macro for development logging, compiled out below the level of the subsystem
+#define LOG_AT(level, function, ...) \
+        do \
+        { \
+                if constexpr ((level) >= LOG_SUBSYSTEM_LEVEL) \
+                { \
+                        function(__VA_ARGS__); \
+                } \
+        } while (0)
+#define LOG_TRACE(...) LOG_AT(LOG_LEVEL_TRACE, spdlog::trace, __VA_ARGS__)
+#define LOG_DEBUG(...) LOG_AT(LOG_LEVEL_DEBUG, spdlog::debug, __VA_ARGS__)
+#define LOG_INFO(...) LOG_AT(LOG_LEVEL_INFO, spdlog::info, __VA_ARGS__)
+#define LOG_WARN(...) LOG_AT(LOG_LEVEL_WARN, spdlog::warn, __VA_ARGS__)
+#define LOG_ERROR(...) LOG_AT(LOG_LEVEL_ERROR, spdlog::error, __VA_ARGS__)
+#define LOG_CRITICAL(...) LOG_AT(LOG_LEVEL_CRITICAL, spdlog::critical, __VA_ARGS__)
 // Macros to set log level
 #define SET_LOG_LEVEL_TRACE() spdlog::set_level(spdlog::level::trace)
 #define SET_LOG_LEVEL_DEBUG() spdlog::set_level(spdlog::level::debug)
@@ -38,6 +97,19 @@ Notes: x
         auto logger = std::make_shared<spdlog::logger>("multi_sink", sinks.begin(), sinks.end()); \
         spdlog::set_default_logger(logger); \
 }
+// Macro to move the sinks of the default logger behind a queue written by a background thread,
+// call it after SET_LOG_FILE() and SET_LOG_LEVEL_*() and flush with SHUTDOWN_LOG()
+#define SET_LOG_ASYNC() \
+{ \
+        spdlog::init_thread_pool(8192, 1); \
+        auto sync_logger = spdlog::default_logger(); \
+        auto logger = std::make_shared<spdlog::async_logger>("async", sync_logger->sinks().begin(), \
+                sync_logger->sinks().end(), spdlog::thread_pool(), spdlog::async_overflow_policy::block); \
+        logger->set_level(sync_logger->level()); \
+        spdlog::set_default_logger(logger); \
+}
+// Macro to flush the queued messages and stop the background thread
+#define SHUTDOWN_LOG() spdlog::shutdown()
 #else // RELEASE
 // Define macros as no-operation if not in development mode
 #define LOG_TRACE(...) (void)0
@@ -56,6 +128,8 @@ Notes: x
 #define SET_LOG_LEVEL_OFF() (void)0
 
 #define SET_LOG_FILE(filename) (void)0
+#define SET_LOG_ASYNC() (void)0
+#define SHUTDOWN_LOG() (void)0
 #endif // RELEASE
 
-#endif // !MACROS_HPP
\ No newline at end of file
+#endif // !MACROS_HPP
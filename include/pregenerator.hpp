@@ -0,0 +1,60 @@
+/*
+Date: 18/10/2026
+
+Pregenerator keeps a few puzzles of every difficulty ready, so starting a new game does not have
+to wait for a puzzle to be generated.
+
+A single background thread generates the puzzles into one RingBuffer per difficulty and sleeps
+once they are all full. The game thread pops from the buffers without taking any lock and wakes
+the producer up again. Every puzzle is GeneratorPool::generateOne() of its seed, so a popped
+puzzle is replayed by generating from the seed.
+*/
+
+#ifndef SUDOKU_PREGENERATOR_HPP
+#define SUDOKU_PREGENERATOR_HPP
+
+#include "difficulty.hpp"
+#include "generatorPool.hpp"
+#include "ringBuffer.hpp"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+namespace Sudoku
+{
+        class Pregenerator
+        {
+        public: // Methods
+        // Class methods
+                Pregenerator();
+                ~Pregenerator();
+                Pregenerator(const Pregenerator&) = delete;
+                Pregenerator& operator=(const Pregenerator&) = delete;
+        // Pregenerator methods
+                void start(const std::array<bool, 4>& levels = {true, true, true, true});
+                void stop() noexcept;
+                bool pop(Difficulty difficulty, GeneratedPuzzle& puzzle);
+        // Getters
+                size_t size(Difficulty difficulty) const noexcept;
+        // Checker
+                bool isRunning() const noexcept;
+        private: // Methods
+        // Pregenerator methods
+                void run();
+                bool isHungry() const noexcept;
+        private: // Variables
+                static constexpr size_t CAPACITY = 4;                           // Puzzles kept ready per difficulty
+
+                std::array<RingBuffer<GeneratedPuzzle, CAPACITY>, 4> queues;    // Ready puzzles, one queue per LEVELS entry
+                std::array<bool, 4> enabled = {};                               // Difficulties being generated
+                std::thread producer;
+                std::atomic<bool> running{false};
+                std::mutex mutex;                                               // Only guards the sleep of the producer
+                std::condition_variable wakeUp;
+        };
+}
+
+#endif // !SUDOKU_PREGENERATOR_HPP
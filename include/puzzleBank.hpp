@@ -0,0 +1,110 @@
+/*
+Date: 18/10/2026
+
+PuzzleBank is a file of pregenerated puzzles which is memory mapped instead of read, so a new
+game picks a puzzle in O(1) without generating or parsing anything. Only the pages of the puzzles
+actually picked are ever loaded, a bank of millions of puzzles costs no memory up front.
+
+File layout (native byte order):
+        BankHeader: 128 bytes, magic, version, record size and one section per difficulty
+        BankRecord[count]: 128 bytes each, the puzzles of a difficulty are contiguous
+
+Banks are produced offline with PuzzleBank::build(). The header is checked when the bank is
+opened, a record only when it is picked, so a corrupt record is skipped instead of loading the
+whole file up front to check it.
+
+The bank is mapped with POSIX (open, fstat, mmap, madvise). Windows has none of them, there the
+whole file is read into memory when it is opened instead, which costs its size in memory but
+works the same otherwise.
+*/
+
+#ifndef SUDOKU_PUZZLE_BANK_HPP
+#define SUDOKU_PUZZLE_BANK_HPP
+
+#include "difficulty.hpp"
+#include "grid.hpp"
+#include "random.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Sudoku
+{
+        /*
+        A single puzzle of the bank.
+        */
+        struct BankRecord
+        {
+                PackedGrid puzzle;                                              // The givens, marked as fixed
+                PackedGrid solution;                                            // The unique solution
+                uint64_t seed;                                                  // Seed the puzzle was generated from
+                uint16_t score;                                                 // Score given by the Grader
+                uint8_t technique;                                              // Hardest technique, a Technique
+                uint8_t difficulty;                                             // Difficulty, a Difficulty
+                std::array<uint8_t, 12> reserved;                               // Padding to 128 bytes, zero
+        };
+
+        /*
+        Range of records holding the puzzles of one difficulty.
+        */
+        struct BankSection
+        {
+                uint64_t first;                                                 // Index of the first record
+                uint64_t count;                                                 // Number of records
+        };
+
+        /*
+        Header at the start of the bank file.
+        */
+        struct BankHeader
+        {
+                std::array<char, 8> magic;                                      // "SDKBANK\0"
+                uint32_t version;                                               // Format version
+                uint32_t recordSize;                                            // sizeof(BankRecord)
+                uint64_t count;                                                 // Number of records
+                std::array<BankSection, 4> sections;                            // EASY, MEDIUM, HARD, EXPERT
+                std::array<uint8_t, 40> reserved;                               // Padding to 128 bytes, zero
+        };
+
+        static_assert(sizeof(BankRecord) == 128, "BankRecord must stay 128 bytes");
+        static_assert(sizeof(BankHeader) == 128, "BankHeader must stay 128 bytes");
+
+        class PuzzleBank
+        {
+        public: // Methods
+        // Class methods
+                PuzzleBank();
+                explicit PuzzleBank(const std::string& path);
+                ~PuzzleBank();
+                PuzzleBank(const PuzzleBank&) = delete;
+                PuzzleBank& operator=(const PuzzleBank&) = delete;
+        // Bank methods
+                void open(const std::string& path);
+                void close() noexcept;
+                const BankRecord* pick(Difficulty difficulty, Random& random) const;
+                static void build(const std::string& path, const std::array<size_t, 4>& counts,
+                        uint64_t masterSeed, size_t threads = 0);
+        // Getters
+                const BankRecord& getRecord(size_t index) const;
+                size_t size() const noexcept;
+                size_t count(Difficulty difficulty) const noexcept;
+        // Checker
+                bool isOpen() const noexcept;
+                static bool isValidRecord(const BankRecord& record) noexcept;
+        // Utility methods
+                static int getSection(Difficulty difficulty) noexcept;
+        private: // Variables
+                static constexpr uint32_t VERSION = 2;                          // 2: X_CHAIN and XY_CHAIN before GUESS
+                static constexpr size_t CHUNK = 4096;                           // Puzzles generated at once by build()
+
+                void* mapping = nullptr;                                        // The mapped file
+                size_t length = 0;                                              // Length of the mapping in bytes
+                std::vector<uint64_t> contents;                                 // The file read into memory on Windows
+                const BankHeader* header = nullptr;
+                const BankRecord* records = nullptr;
+        };
+}
+
+#endif // !SUDOKU_PUZZLE_BANK_HPP
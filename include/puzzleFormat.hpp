@@ -0,0 +1,30 @@
+/*
+Date: 18/10/2026
+
+PuzzleFormat reads and writes puzzles in the common one line format: 81 characters in reading
+order, a digit for every given and '0' or '.' for every empty cell. Anything after the 81st
+character (a rating, a comment) is ignored, so most published puzzle collections can be read as
+they are.
+*/
+
+#ifndef SUDOKU_PUZZLE_FORMAT_HPP
+#define SUDOKU_PUZZLE_FORMAT_HPP
+
+#include "grid.hpp"
+#include <string>
+
+namespace Sudoku
+{
+        class PuzzleFormat
+        {
+        public: // Methods
+        // Parsing
+                static bool parse(const std::string& line, Grid& grid);
+                static bool parse(const std::string& line, PackedGrid& packed);
+        // Formatting
+                static std::string format(const Grid& grid);
+                static std::string format(const PackedGrid& packed);
+        };
+}
+
+#endif // !SUDOKU_PUZZLE_FORMAT_HPP
@@ -0,0 +1,71 @@
+/*
+Date: 18/10/2026
+
+PuzzleRunner solves lists of puzzles with a chosen engine on a pool of threads and times every
+puzzle. It is the engine room of the command line solver.
+
+Available engines:
+        BACKTRACKING: Solver, one puzzle at a time.
+        DANCING_LINKS: DlxSolver, one puzzle at a time.
+        BATCH: BatchSolver, a group of puzzles in lockstep. The puzzles of a group share its time
+        equally, there is no way to time them one by one.
+
+The puzzles are split into chunks which the threads solve independently, every chunk with its
+own solver, so the results do not depend on the number of threads.
+*/
+
+#ifndef SUDOKU_PUZZLE_RUNNER_HPP
+#define SUDOKU_PUZZLE_RUNNER_HPP
+
+#include "grid.hpp"
+#include "solver.hpp"
+#include "threadPool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Sudoku
+{
+        enum class Engine
+        {
+                BACKTRACKING,
+                DANCING_LINKS,
+                BATCH
+        };
+
+        /*
+        Result of one puzzle.
+        */
+        struct RunResult
+        {
+                SolverStatus status;                                            // SOLVED or UNSOLVABLE
+                uint64_t nanoseconds;                                           // Time spent solving the puzzle
+        };
+
+        class PuzzleRunner
+        {
+        public: // Methods
+        // Class methods
+                explicit PuzzleRunner(Engine engine, size_t threads = 0);
+                ~PuzzleRunner();
+        // Runner methods
+                size_t solve(PackedGrid* grids, size_t count, RunResult* results);
+        // Getters
+                Engine getEngine() const noexcept;
+                size_t getThreads() const noexcept;
+        // Utility methods
+                static bool parseEngine(const std::string& name, Engine& engine) noexcept;
+                static bool parseThreads(const std::string& text, size_t& threads) noexcept;
+                static size_t maxThreads() noexcept;
+                static const char* getName(Engine engine) noexcept;
+        private: // Methods
+        // Runner methods
+                void solveChunk(PackedGrid* grids, size_t count, RunResult* results) const;
+        private: // Variables
+                static constexpr size_t CHUNK = 64;                             // Puzzles per task, a multiple of every batch width
+                Engine engine;
+                ThreadPool pool;
+        };
+}
+
+#endif // !SUDOKU_PUZZLE_RUNNER_HPP
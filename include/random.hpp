@@ -0,0 +1,153 @@
+/*
+Date: 18/10/2026
+
+Random is the random number generator used by the game logic. It implements xoshiro256**,
+which is much faster than std::mt19937, has a 32 byte state and is seeded from a single 64-bit
+number. The same seed always gives the same numbers, so a game can be replayed from its seed.
+
+The game logic draws with below() and shuffle() only. The standard library leaves the output of
+std::shuffle and of the std distributions to each implementation, so with them the same seed
+gives another puzzle under libc++ than under libstdc++, and the seeds of the puzzle bank and the
+benchmark corpus would not replay. Random still satisfies the UniformRandomBitGenerator
+requirements for code which does not need to replay.
+*/
+
+#ifndef SUDOKU_RANDOM_HPP
+#define SUDOKU_RANDOM_HPP
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+namespace Sudoku
+{
+        class Random
+        {
+        public: // Types
+                using result_type = uint64_t;
+        public: // Methods
+        // Class methods
+                Random();
+                explicit Random(uint64_t seed) noexcept;
+        // Generator methods
+                void seed(uint64_t seed) noexcept;
+
+                /*
+                Returns the next random number.
+
+                @return The random number.
+                */
+                result_type operator()() noexcept
+                {
+                        const uint64_t result = rotate(state[1] * 5, 7) * 9;
+                        const uint64_t t = state[1] << 17;
+
+                        state[2] ^= state[0];
+                        state[3] ^= state[1];
+                        state[1] ^= state[2];
+                        state[0] ^= state[3];
+                        state[2] ^= t;
+                        state[3] = rotate(state[3], 45);
+
+                        return result;
+                }
+
+                static constexpr result_type min() noexcept
+                {
+                        return std::numeric_limits<result_type>::min();
+                }
+
+                static constexpr result_type max() noexcept
+                {
+                        return std::numeric_limits<result_type>::max();
+                }
+
+                /*
+                Returns a uniformly random number below a bound, with the multiply and reject
+                method of Lemire, which needs a division only when a draw may be rejected.
+
+                @param bound The bound. Must be at least 1.
+
+                @return The random number in the range [0, bound - 1].
+                */
+                uint64_t below(uint64_t bound) noexcept
+                {
+                        uint64_t high;
+                        uint64_t low;
+                        multiply((*this)(), bound, high, low);
+
+                        if (low < bound)
+                        {
+                                // 2^64 mod bound, the draws below it would make small numbers likelier
+                                const uint64_t threshold = (0 - bound) % bound;
+                                while (low < threshold)
+                                {
+                                        multiply((*this)(), bound, high, low);
+                                }
+                        }
+
+                        return high;
+                }
+
+                /*
+                Shuffles a range with the Fisher-Yates algorithm, every order is equally likely.
+
+                @param first The start of the range.
+                @param last The end of the range.
+                */
+                template <typename Iterator>
+                void shuffle(Iterator first, Iterator last) noexcept
+                {
+                        const auto size = static_cast<uint64_t>(std::distance(first, last));
+
+                        for (uint64_t i = size; i > 1; i--)
+                        {
+                                using std::swap;
+                                swap(first[i - 1], first[below(i)]);
+                        }
+                }
+        // Utility methods
+                static uint64_t randomSeed();
+                static uint64_t mix(uint64_t value) noexcept;
+        private: // Methods
+                static constexpr uint64_t rotate(uint64_t value, int bits) noexcept
+                {
+                        return (value << bits) | (value >> (64 - bits));
+                }
+
+                /*
+                Multiplies two 64-bit numbers into a 128-bit product.
+
+                @param a The first factor.
+                @param b The second factor.
+                @param high Receives the upper 64 bits of the product.
+                @param low Receives the lower 64 bits of the product.
+                */
+                static constexpr void multiply(uint64_t a, uint64_t b, uint64_t& high, uint64_t& low) noexcept
+                {
+                        #ifdef __SIZEOF_INT128__
+                        const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+                        high = static_cast<uint64_t>(product >> 64);
+                        low = static_cast<uint64_t>(product);
+                        #else
+                        // Schoolbook multiplication of the 32-bit halves, for compilers without __int128
+                        const uint64_t aLow = a & 0xFFFFFFFFULL;
+                        const uint64_t aHigh = a >> 32;
+                        const uint64_t bLow = b & 0xFFFFFFFFULL;
+                        const uint64_t bHigh = b >> 32;
+                        const uint64_t lowLow = aLow * bLow;
+                        const uint64_t highLow = aHigh * bLow;
+                        const uint64_t lowHigh = aLow * bHigh;
+                        const uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFFULL) + lowHigh;
+                        high = aHigh * bHigh + (highLow >> 32) + (middle >> 32);
+                        low = (middle << 32) | (lowLow & 0xFFFFFFFFULL);
+                        #endif // __SIZEOF_INT128__
+                }
+        private: // Variables
+                std::array<uint64_t, 4> state;
+        };
+}
+
+#endif // !SUDOKU_RANDOM_HPP
@@ -0,0 +1,96 @@
+/*
+Date: 18/10/2026
+
+RingBuffer is a fixed size, lock-free queue for exactly one producer thread and one consumer
+thread. The producer only writes the tail and the consumer only writes the head, so a push or a
+pop is one acquire load and one release store, without any lock or compare-and-swap.
+*/
+
+#ifndef SUDOKU_RING_BUFFER_HPP
+#define SUDOKU_RING_BUFFER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace Sudoku
+{
+        template <typename T, size_t Capacity>
+        class RingBuffer
+        {
+                static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+        public: // Methods
+        // Producer methods
+                /*
+                Adds an item at the tail. Must only be called by the producer thread.
+
+                @param item The item.
+
+                @return True if the item was added, false if the buffer is full.
+                */
+                bool push(const T& item)
+                {
+                        size_t tailIndex = tail.load(std::memory_order_relaxed);
+
+                        if (tailIndex - head.load(std::memory_order_acquire) == Capacity)
+                        {
+                                return false;
+                        }
+
+                        items[tailIndex & (Capacity - 1)] = item;
+                        tail.store(tailIndex + 1, std::memory_order_release);
+
+                        return true;
+                }
+        // Consumer methods
+                /*
+                Removes the item at the head. Must only be called by the consumer thread.
+
+                @param item The item to store the removed item in.
+
+                @return True if an item was removed, false if the buffer is empty.
+                */
+                bool pop(T& item)
+                {
+                        size_t headIndex = head.load(std::memory_order_relaxed);
+
+                        if (headIndex == tail.load(std::memory_order_acquire))
+                        {
+                                return false;
+                        }
+
+                        item = items[headIndex & (Capacity - 1)];
+                        head.store(headIndex + 1, std::memory_order_release);
+
+                        return true;
+                }
+        // Getters
+                /*
+                Returns the number of items. Exact when called by the producer or the consumer
+                while the other one is idle, a snapshot otherwise.
+
+                @return The number of items.
+                */
+                size_t size() const noexcept
+                {
+                        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+                }
+
+                /*
+                Returns the maximum number of items.
+
+                @return The capacity.
+                */
+                static constexpr size_t capacity() noexcept
+                {
+                        return Capacity;
+                }
+        private: // Variables
+                // The indices only ever grow, the slot is the index modulo the capacity
+                alignas(64) std::atomic<size_t> head{0};                        // Next item to pop, written by the consumer
+                alignas(64) std::atomic<size_t> tail{0};                        // Next slot to push, written by the producer
+                alignas(64) std::array<T, Capacity> items{};
+        };
+}
+
+#endif // !SUDOKU_RING_BUFFER_HPP
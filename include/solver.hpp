@@ -2,26 +2,101 @@
 Date: 09/11/2024
 
 Solver is class which given a sudoku grid, solves it using backtracking.
+
+Before every branch the cells forced by the rules (naked and hidden singles) are filled. The
+search then branches on the empty cell with the fewest candidates and walks the candidates of
+the cell directly from its bitmask. The filled cells are kept behind the empty ones in a single
+list so a failed branch is undone by emptying the cells at the end of the list.
+
+The search does not recurse, it keeps one frame per branched cell on a fixed size stack. This
+bounds the memory used and lets a long search be paused with a node budget and resumed later,
+see start() and resume().
+
+The solver is a template over a statistics policy (see solverStats.hpp). Solver keeps none,
+StatsSolver counts the nodes, backtracks, guesses and propagations of every search and times it.
+Both are compiled once in solver.cpp.
 */
 
 #ifndef SUDOKU_SOLVER_HPP
 #define SUDOKU_SOLVER_HPP
 
 #include "grid.hpp"
+#include "solverStats.hpp"
+#include "solverStrategy.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace Sudoku
 {
-        class Solver
+        /*
+        State of a search run by Solver::resume().
+        */
+        enum class SolverStatus
+        {
+                IN_PROGRESS,
+                SOLVED,
+                UNSOLVABLE
+        };
+
+        template <typename Stats>
+        class BasicSolver : public SolverStrategy
         {
         public: // Methods
         // Class methods
-                Solver();
-                ~Solver();
+                BasicSolver();
+                ~BasicSolver() override;
         // Solver methods
-                bool solve(Grid& grid);
-                bool backtrack(Grid& grid, size_t index, int zeroCount);
+                bool solve(Grid& grid) override;
+                int countSolutions(const Grid& grid, int limit = 2) override;
+                void start(Grid& grid, int limit = 1);
+                SolverStatus resume(Grid& grid, size_t nodeBudget = SIZE_MAX);
+        // Getters
+                const Stats& getStats() const noexcept;
+        private: // Methods
+        // Search steps
+                void enter(Grid& grid) noexcept;
+                void next(Grid& grid) noexcept;
+                void finish() noexcept;
+        // Search helpers
+                int collectEmptyCells(const Grid& grid) noexcept;
+                int chooseCell(const Grid& grid, int emptyCount) const noexcept;
+                void swapEmptyCells(int a, int b) noexcept;
+        // Propagation
+                bool propagate(Grid& grid, int& emptyCount) noexcept;
+                bool placeHidden(Grid& grid, size_t house, int value, int& emptyCount) noexcept;
+                void place(Grid& grid, int position, int value, int& emptyCount) noexcept;
+                void undo(Grid& grid, int emptyCount, int startCount) noexcept;
+        private: // Variables
+                /*
+                One level of the search: the cell branched on and the candidates not tried yet.
+                */
+                struct Frame
+                {
+                        uint8_t cell;                                           // Index of the cell
+                        uint16_t candidates;                                    // Candidates left to try
+                        uint8_t startCount;                                     // Empty cells when the node was entered
+                        uint8_t branchCount;                                    // Empty cells after propagation
+                };
+
+                std::array<Frame, 81> stack;                                    // Explicit search stack
+                int depth = 0;                                                  // Number of frames on the stack
+                bool entering = false;                                          // Whether the next step enters a new node
+                int unsolvedCount = 0;                                          // Number of unsolved cells at the front of emptyCells
+                int solutionLimit = 1;                                          // Solutions after which the search stops
+                int solutionCount = 0;                                          // Solutions found so far
+                SolverStatus status = SolverStatus::UNSOLVABLE;                 // State of the current search
+                std::array<uint8_t, 81> emptyCells;                             // Indices of the empty cells, the unsolved ones first
+                std::array<uint8_t, 81> positions;                              // Position of every empty cell in emptyCells
+                Stats stats;                                                    // Statistics of the current search
         };
+
+        using Solver = BasicSolver<NoSolverStats>;
+        using StatsSolver = BasicSolver<SolverStats>;
+
+        extern template class BasicSolver<NoSolverStats>;
+        extern template class BasicSolver<SolverStats>;
 }
 
 #endif // !SUDOKU_SOLVER_HPP
\ No newline at end of file
@@ -0,0 +1,103 @@
+/*
+Date: 18/10/2026
+
+Statistics policies of the backtracking solver. BasicSolver (see solver.hpp) calls the hooks of its
+policy at every step of the search:
+        SolverStats: counts the steps and times the search, see getStats().
+        NoSolverStats: empty hooks which compile to nothing, the default of Solver.
+
+The policy is a template parameter rather than a runtime flag, so the plain Solver does not pay a
+single branch or counter for the statistics it does not keep.
+*/
+
+#ifndef SUDOKU_SOLVER_STATS_HPP
+#define SUDOKU_SOLVER_STATS_HPP
+
+#include <cstdint>
+
+namespace Sudoku
+{
+        /*
+        Statistics of one search, filled by a StatsSolver.
+        */
+        struct SolverStats
+        {
+                static constexpr bool ENABLED = true;
+
+                uint64_t nodes = 0;                                             // Search nodes entered
+                uint64_t backtracks = 0;                                        // Nodes abandoned after a contradiction or a counted solution
+                uint64_t guesses = 0;                                           // Candidates tried for a branched cell
+                uint64_t propagations = 0;                                      // Cells filled by naked and hidden singles
+                uint32_t maxDepth = 0;                                          // Deepest level of the search stack
+                uint64_t nanoseconds = 0;                                       // Wall time spent in the search
+
+                /*
+                Called when a node is entered.
+                */
+                void node() noexcept
+                {
+                        nodes++;
+                }
+
+                /*
+                Called when a node is abandoned.
+                */
+                void backtrack() noexcept
+                {
+                        backtracks++;
+                }
+
+                /*
+                Called when a candidate of a branched cell is tried.
+                */
+                void guess() noexcept
+                {
+                        guesses++;
+                }
+
+                /*
+                Called when a forced cell is filled.
+                */
+                void propagation() noexcept
+                {
+                        propagations++;
+                }
+
+                /*
+                Called when a frame is pushed.
+
+                @param depth The number of frames on the stack.
+                */
+                void depth(uint32_t depth) noexcept
+                {
+                        maxDepth = depth > maxDepth ? depth : maxDepth;
+                }
+
+                /*
+                Called when the search pauses or ends.
+
+                @param time The nanoseconds spent since the search was resumed.
+                */
+                void time(uint64_t time) noexcept
+                {
+                        nanoseconds += time;
+                }
+        };
+
+        /*
+        Statistics which are not kept.
+        */
+        struct NoSolverStats
+        {
+                static constexpr bool ENABLED = false;
+
+                void node() noexcept {}
+                void backtrack() noexcept {}
+                void guess() noexcept {}
+                void propagation() noexcept {}
+                void depth(uint32_t) noexcept {}
+                void time(uint64_t) noexcept {}
+        };
+}
+
+#endif // !SUDOKU_SOLVER_STATS_HPP
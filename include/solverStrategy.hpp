@@ -0,0 +1,42 @@
+/*
+Date: 18/10/2026
+
+SolverStrategy is the common interface of all the sudoku solvers so the caller can pick the
+algorithm which fits the puzzles at hand.
+
+Available strategies:
+        BACKTRACKING: Solver, backtracking on the cell with the fewest candidates with naked and
+                hidden singles filled before every branch, on an explicit stack. The fastest
+                engine on every corpus of bench/corpus, hard puzzles included.
+        DANCING_LINKS: DlxSolver, exact cover search. Slower, but shares no code with Solver,
+                which makes it a cross check of its results.
+*/
+
+#ifndef SUDOKU_SOLVER_STRATEGY_HPP
+#define SUDOKU_SOLVER_STRATEGY_HPP
+
+#include "grid.hpp"
+#include <memory>
+
+namespace Sudoku
+{
+        enum class SolverType
+        {
+                BACKTRACKING,
+                DANCING_LINKS
+        };
+
+        class SolverStrategy
+        {
+        public: // Methods
+        // Class methods
+                virtual ~SolverStrategy() = default;
+        // Solver methods
+                virtual bool solve(Grid& grid) = 0;
+                virtual int countSolutions(const Grid& grid, int limit = 2) = 0;
+        };
+
+        std::unique_ptr<SolverStrategy> createSolver(SolverType type);
+}
+
+#endif // !SUDOKU_SOLVER_STRATEGY_HPP
@@ -0,0 +1,64 @@
+/*
+Date: 18/10/2026
+
+ThreadPool runs tasks on a fixed number of worker threads.
+
+Every worker has its own task queue. A worker takes the newest task from its own queue and,
+once that is empty, steals the oldest task from the queues of the other workers. Tasks submitted
+from outside the pool are spread over the queues round robin, tasks submitted by a worker go to
+its own queue.
+*/
+
+#ifndef SUDOKU_THREAD_POOL_HPP
+#define SUDOKU_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Sudoku
+{
+        class ThreadPool
+        {
+        public: // Methods
+        // Class methods
+                explicit ThreadPool(size_t threads = 0);
+                ~ThreadPool();
+                ThreadPool(const ThreadPool&) = delete;
+                ThreadPool& operator=(const ThreadPool&) = delete;
+        // Task methods
+                void submit(std::function<void()> task);
+                void wait();
+        // Utility methods
+                size_t size() const noexcept;
+        private: // Methods
+        // Worker methods
+                void run(size_t index);
+                bool pop(size_t index, std::function<void()>& task);
+                bool steal(size_t index, std::function<void()>& task);
+        private: // Variables
+                struct Queue
+                {
+                        std::mutex mutex;
+                        std::deque<std::function<void()>> tasks;
+                };
+
+                std::vector<std::unique_ptr<Queue>> queues;                     // One queue per worker
+                std::vector<std::thread> workers;
+                std::mutex mutex;                                               // Guards sleeping and waking up
+                std::condition_variable wake;                                   // Signals new tasks or stopping
+                std::condition_variable done;                                   // Signals that all the tasks finished
+                std::atomic<size_t> queued{0};                                  // Tasks waiting in the queues
+                std::atomic<size_t> pending{0};                                 // Tasks submitted but not finished
+                std::atomic<size_t> nextQueue{0};                               // Round robin for outside submits
+                bool stopping = false;
+        };
+}
+
+#endif // !SUDOKU_THREAD_POOL_HPP
@@ -0,0 +1,136 @@
+/*
+Date: 18/10/2026
+
+Tracer records timed spans of the hot paths (event handling, rendering, scene construction, new
+games, solves) and writes them as a Chrome trace, which chrome://tracing and Perfetto show as a
+timeline per thread.
+
+A span is recorded when a ScopedSpan is destroyed, into a fixed size ring buffer of the calling
+thread: no lock and no allocation after the first span of a thread, and the oldest spans are
+overwritten once the buffer is full. The timestamps come from std::chrono::steady_clock.
+
+A buffer holds CAPACITY spans (about 400 KB) and outlives its thread, so the spans of a finished
+worker still make it into the trace. The buffers of finished threads are freed by clear(), a
+process which keeps starting new traced threads must call it from time to time.
+
+write() reads the buffers without stopping their threads, so it must be called once the traced
+threads have stopped: the game writes the trace after the Application and its thread pools are
+destroyed.
+
+The instrumentation is compiled in with the TRACING CMake option, otherwise TRACE_SCOPE() and
+TRACE_THREAD() expand to nothing. The game writes the trace when it closes, to the path in the
+SUDOKU_TRACE environment variable or to trace.json.
+*/
+
+#ifndef SUDOKU_TRACER_HPP
+#define SUDOKU_TRACER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef TRACING
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+// Macro to time the rest of the enclosing scope, name must be a string literal
+#define TRACE_SCOPE(name) ::Sudoku::ScopedSpan TRACE_CONCAT(traceSpan, __LINE__)(name)
+// Macro to name the calling thread in the trace
+#define TRACE_THREAD(name) ::Sudoku::Tracer::setThreadName(name)
+#else
+#define TRACE_SCOPE(name) (void)0
+#define TRACE_THREAD(name) (void)0
+#endif // TRACING
+
+namespace Sudoku
+{
+        /*
+        A finished span.
+        */
+        struct Span
+        {
+                const char* name;                                               // Static string naming the span
+                uint64_t start;                                                 // Nanoseconds of the steady clock
+                uint64_t end;                                                   // Nanoseconds of the steady clock
+        };
+
+        class Tracer
+        {
+        public: // Methods
+        // Recording methods
+                static uint64_t now() noexcept;
+                static void record(const char* name, uint64_t start, uint64_t end);
+                static void setThreadName(const std::string& name);
+        // Output methods
+                static void write(const std::string& path);
+                static size_t size();
+                static void clear();
+        public: // Variables
+                static constexpr size_t CAPACITY = 1 << 14;                     // Spans kept per thread, a power of two
+        private: // Types
+                /*
+                Spans of one thread, only written by that thread.
+                */
+                struct Buffer
+                {
+                        std::array<Span, CAPACITY> spans;
+                        std::atomic<size_t> count{0};                           // Spans recorded, the last CAPACITY are kept
+                        uint32_t thread = 0;                                    // Id of the thread in the trace
+                        std::string name;                                       // Name of the thread in the trace
+                        bool finished = false;                                  // The thread ended, freed by clear()
+                };
+
+                /*
+                Buffers of all the threads which recorded a span, kept after the threads end until
+                clear() is called.
+                */
+                struct Registry
+                {
+                        std::mutex mutex;                                       // Guards buffers, names and finished
+                        std::vector<std::unique_ptr<Buffer>> buffers;
+                        uint32_t threads = 0;                                   // Threads registered so far
+                };
+
+                /*
+                Marks the buffer of a thread finished when the thread ends.
+                */
+                struct Owner
+                {
+                        Buffer* buffer = nullptr;
+
+                        ~Owner();
+                };
+        private: // Methods
+                static Buffer& buffer();
+                static Registry& registry();
+        };
+
+        /*
+        Records a span from its construction to its destruction, see TRACE_SCOPE().
+        */
+        class ScopedSpan
+        {
+        public: // Methods
+        // Class methods
+                explicit ScopedSpan(const char* name) noexcept : name(name), start(Tracer::now())
+                {
+                }
+
+                ~ScopedSpan()
+                {
+                        Tracer::record(name, start, Tracer::now());
+                }
+
+                ScopedSpan(const ScopedSpan&) = delete;
+                ScopedSpan& operator=(const ScopedSpan&) = delete;
+        private: // Variables
+                const char* name;
+                uint64_t start;
+        };
+}
+
+#endif // !SUDOKU_TRACER_HPP
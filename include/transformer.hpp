@@ -0,0 +1,47 @@
+/*
+Date: 18/10/2026
+
+Transformer turns a grid into an equivalent one. Relabeling the digits, permuting the rows inside
+a band, the columns inside a stack, the bands, the stacks and transposing all map valid grids to
+valid grids and keep the number of solutions of a puzzle, so a single solved grid yields about
+1.2 * 10^12 different games without solving anything.
+
+A transformation is drawn once and then applied to the puzzle and to its solution alike.
+*/
+
+#ifndef SUDOKU_TRANSFORMER_HPP
+#define SUDOKU_TRANSFORMER_HPP
+
+#include "grid.hpp"
+#include "random.hpp"
+#include <array>
+#include <cstdint>
+
+namespace Sudoku
+{
+        /*
+        An element of the symmetry group of the sudoku grid.
+        */
+        struct Transformation
+        {
+                std::array<uint8_t, 10> digits;                                 // New value of every value, digits[0] is 0
+                std::array<uint8_t, 9> rows;                                    // Old row of every new row
+                std::array<uint8_t, 9> cols;                                    // Old column of every new column
+                bool transpose;                                                 // If rows and columns are swapped last
+        };
+
+        class Transformer
+        {
+        public: // Methods
+        // Transformer methods
+                static Transformation identity() noexcept;
+                static Transformation random(Random& random);
+                static void apply(const Transformation& transformation, const Grid& grid, Grid& result);
+                static void apply(const Transformation& transformation, Grid& grid);
+        private: // Methods
+        // Transformer methods
+                static void shuffleLines(std::array<uint8_t, 9>& lines, Random& random);
+        };
+}
+
+#endif // !SUDOKU_TRANSFORMER_HPP
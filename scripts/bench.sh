@@ -0,0 +1,33 @@
+#!/bin/bash
+
+# Usage: ./scripts/bench.sh [output] [filter]
+#
+# Builds the benchmarks without the game and runs them, writing the results as Google Benchmark
+# JSON to output (default: build/bench/results/<date>-<commit>.json). The optional filter is a
+# regular expression selecting the benchmarks to run. Every benchmark is repeated
+# BENCH_REPETITIONS times (default 3) and only the mean, median and standard deviation are kept,
+# so results of different runs can be compared with Google Benchmark's tools/compare.py.
+
+# Exit immediately if a command exits with a non-zero status.
+set -e
+
+# Build the benchmarks
+./scripts/build.sh headless bench
+
+# Name the results after the date and the commit they were measured on
+commit=$(git rev-parse --short HEAD 2>/dev/null || echo "unknown")
+output=${1:-"build/bench/results/$(date +%Y%m%d-%H%M%S)-${commit}.json"}
+filter=${2:-"."}
+repetitions=${BENCH_REPETITIONS:-3}
+
+mkdir -p "$(dirname "$output")"
+
+echo "Running the benchmarks..."
+./build/bench/Bench \
+        --benchmark_filter="$filter" \
+        --benchmark_repetitions="$repetitions" \
+        --benchmark_report_aggregates_only=true \
+        --benchmark_out="$output" \
+        --benchmark_out_format=json
+
+echo "Results written to $output"
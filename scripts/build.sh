@@ -1,6 +1,6 @@
 #!/bin/bash
 
-# Usage: ./scripts/build.sh [dev] [test]
+# Usage: ./scripts/build.sh [dev] [test] [bench] [cli] [headless] [trace]
 
 # Exit immediately if a command exits with a non-zero status.
 set -e
@@ -19,8 +19,14 @@ fi
 # Move to the build directory
 cd build
 
-# Initialize CMake flags
-cmake_flags=""
+# Every option is passed on each call, so nothing is kept from an earlier build in the same
+# directory (bench.sh and regression.sh build headless here)
+development=OFF
+test=OFF
+bench=OFF
+cli=OFF
+gui=ON
+tracing=OFF
 
 # Parse arguments
 for arg in "$@"
@@ -29,26 +35,43 @@ do
         case $arg in
                 dev)
                         echo "Development mode enabled."
-                        cmake_flags+="-DDEVELOPMENT=ON "
+                        development=ON
                         ;;
                 test)
                         echo "Testing enabled."
-                        cmake_flags+="-DTEST=ON "
+                        test=ON
+                        ;;
+                bench)
+                        echo "Benchmarks enabled."
+                        bench=ON
+                        ;;
+                cli)
+                        echo "Command line solver enabled."
+                        cli=ON
+                        ;;
+                headless)
+                        echo "Game disabled, SFML is not needed."
+                        gui=OFF
+                        ;;
+                trace)
+                        echo "Tracing enabled."
+                        tracing=ON
                         ;;
                 *)
                         # Handle unknown options
                         echo "Unknown option: $arg"
-                        echo "Usage: ./scripts/build.sh [dev] [test]"
+                        echo "Usage: ./scripts/build.sh [dev] [test] [bench] [cli] [headless] [trace]"
                         ;;
         esac
 done
 
-# If no flags were added, configure in release mode by default
-if [ -z "$cmake_flags" ]; then
+# Without arguments the game is configured in release mode
+if [ $# -eq 0 ]; then
         echo "Configuring the project with CMake in release mode..."
-        cmake_flags="-DDEVELOPMENT=OFF -DTEST=OFF"
 fi
 
+cmake_flags="-DDEVELOPMENT=$development -DTEST=$test -DBENCH=$bench -DCLI=$cli -DGUI=$gui -DTRACING=$tracing"
+
 # Configure the project with CMake
 cmake .. $cmake_flags
 
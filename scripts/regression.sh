@@ -0,0 +1,22 @@
+#!/bin/bash
+
+# Usage: ./scripts/regression.sh [Regression options]
+#
+# Builds the benchmarks without the game and runs the end to end benchmark on bench/corpus,
+# comparing the results with bench/corpus/baseline.tsv. The options are passed on, for example
+# --threshold 5 to allow the work (search nodes, solver calls) to grow by 5%, --time-threshold 10
+# to also fail on 10% less throughput or 10% more p99 latency, or --record to store the results as
+# the new baseline after an intended change. Exits with a non-zero status if a case regressed,
+# which by default only the numbers of items and the work decide.
+#
+# This is not part of test.sh: test.sh only checks that the game was built and needs its
+# Homebrew setup, while this needs an optimized headless build of the benchmarks.
+
+# Exit immediately if a command exits with a non-zero status.
+set -e
+
+# Build the benchmarks
+./scripts/build.sh headless bench
+
+echo "Running the regression benchmark..."
+./build/bench/Regression --corpus bench/corpus "$@"
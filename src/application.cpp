@@ -4,6 +4,8 @@ Date: 10/11/2024
 Application class controls the overall flow of the program.
 */
 
+#define LOG_SUBSYSTEM GUI
+
 #include "application.hpp"
 #include "macros.hpp"
 #include "gui.hpp"
@@ -51,6 +53,9 @@ namespace System
 
                 runFlag = RunFlag::RUN;
 
+                // Have puzzles ready before the player picks a difficulty
+                gui.getGameHandler().startPregenerating();
+
                 LOG_INFO("Application initialized");
         }
         /*
@@ -98,6 +103,8 @@ namespace System
 
                 LOG_INFO("Closing application...");
 
+                gui.getGameHandler().stopPregenerating();
+
                 runFlag = RunFlag::WILL_STOP;
         }
 // Check methods
@@ -0,0 +1,81 @@
+/*
+Date: 18/10/2026
+
+This file implements the AVX2 propagation kernel of the BatchSolver.
+
+The rest of the program is built for the baseline instruction set, only the functions defined
+in this file are compiled for AVX2. They are called only after BatchSolver checked that the
+CPU supports it. Every other header must be included before the target pragma, otherwise
+their inline functions could be emitted with AVX2 instructions and picked by the linker for
+the whole program.
+*/
+
+#define LOG_SUBSYSTEM SOLVER
+
+#include "gridTables.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Same condition as SUDOKU_BATCH_X86, which is only known after including the kernel
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+// The kernel template has to be defined after the pragma to be compiled for AVX2
+#include "batchKernel.hpp"
+
+namespace Sudoku
+{
+namespace Batch
+{
+        /*
+        Sixteen puzzles at a time in a 256-bit register.
+        */
+        struct Avx2Lanes
+        {
+                using Type = __m256i;
+                static constexpr size_t LANES = 16;
+
+                static Type zero() noexcept { return _mm256_setzero_si256(); }
+                static Type set1(uint16_t value) noexcept { return _mm256_set1_epi16(value); }
+                static Type load(const uint16_t* pointer) noexcept
+                {
+                        return _mm256_load_si256(reinterpret_cast<const __m256i*>(pointer));
+                }
+                static void store(uint16_t* pointer, Type v) noexcept
+                {
+                        _mm256_store_si256(reinterpret_cast<__m256i*>(pointer), v);
+                }
+                static Type bitOr(Type a, Type b) noexcept { return _mm256_or_si256(a, b); }
+                static Type bitAnd(Type a, Type b) noexcept { return _mm256_and_si256(a, b); }
+                static Type andNot(Type a, Type b) noexcept { return _mm256_andnot_si256(a, b); }
+                static Type sub(Type a, Type b) noexcept { return _mm256_sub_epi16(a, b); }
+                static Type equal(Type a, Type b) noexcept { return _mm256_cmpeq_epi16(a, b); }
+                static bool any(Type v) noexcept { return !_mm256_testz_si256(v, v); }
+        };
+
+        /*
+        Runs the propagation kernel on sixteen puzzles.
+        */
+        void propagateAvx2(uint16_t* cells, uint16_t* dead)
+        {
+                propagateSingles<Avx2Lanes>(cells, dead);
+        }
+} // namespace Batch
+} // namespace Sudoku
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#endif // x86
@@ -0,0 +1,356 @@
+/*
+Date: 18/10/2026
+
+This file implements the BatchSolver class together with the scalar and SSE2 propagation
+kernels. The AVX2 kernel lives in batchKernelAvx2.cpp.
+*/
+
+#define LOG_SUBSYSTEM SOLVER
+
+#include "batchKernel.hpp"
+#include "batchSolver.hpp"
+#include "grid.hpp"
+#include "macros.hpp"
+#include "solver.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(SUDOKU_BATCH_X86) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace Sudoku
+{
+namespace Batch
+{
+        /*
+        One puzzle at a time, used when the CPU has no supported SIMD extension.
+        */
+        struct ScalarLanes
+        {
+                using Type = uint16_t;
+                static constexpr size_t LANES = 1;
+
+                static Type zero() noexcept { return 0; }
+                static Type set1(uint16_t value) noexcept { return value; }
+                static Type load(const uint16_t* pointer) noexcept { return *pointer; }
+                static void store(uint16_t* pointer, Type v) noexcept { *pointer = v; }
+                static Type bitOr(Type a, Type b) noexcept { return a | b; }
+                static Type bitAnd(Type a, Type b) noexcept { return a & b; }
+                static Type andNot(Type a, Type b) noexcept { return ~a & b; }
+                static Type sub(Type a, Type b) noexcept { return a - b; }
+                static Type equal(Type a, Type b) noexcept { return a == b ? 0xFFFF : 0; }
+                static bool any(Type v) noexcept { return v != 0; }
+        };
+
+        /*
+        Runs the propagation kernel on a single puzzle.
+        */
+        void propagateScalar(uint16_t* cells, uint16_t* dead)
+        {
+                propagateSingles<ScalarLanes>(cells, dead);
+        }
+
+#if defined(SUDOKU_BATCH_X86) && defined(__SSE2__)
+        /*
+        Eight puzzles at a time in a 128-bit register.
+        */
+        struct Sse2Lanes
+        {
+                using Type = __m128i;
+                static constexpr size_t LANES = 8;
+
+                static Type zero() noexcept { return _mm_setzero_si128(); }
+                static Type set1(uint16_t value) noexcept { return _mm_set1_epi16(value); }
+                static Type load(const uint16_t* pointer) noexcept
+                {
+                        return _mm_load_si128(reinterpret_cast<const __m128i*>(pointer));
+                }
+                static void store(uint16_t* pointer, Type v) noexcept
+                {
+                        _mm_store_si128(reinterpret_cast<__m128i*>(pointer), v);
+                }
+                static Type bitOr(Type a, Type b) noexcept { return _mm_or_si128(a, b); }
+                static Type bitAnd(Type a, Type b) noexcept { return _mm_and_si128(a, b); }
+                static Type andNot(Type a, Type b) noexcept { return _mm_andnot_si128(a, b); }
+                static Type sub(Type a, Type b) noexcept { return _mm_sub_epi16(a, b); }
+                static Type equal(Type a, Type b) noexcept { return _mm_cmpeq_epi16(a, b); }
+                static bool any(Type v) noexcept
+                {
+                        return _mm_movemask_epi8(_mm_cmpeq_epi16(v, _mm_setzero_si128())) != 0xFFFF;
+                }
+        };
+
+        /*
+        Runs the propagation kernel on eight puzzles.
+        */
+        void propagateSse2(uint16_t* cells, uint16_t* dead)
+        {
+                propagateSingles<Sse2Lanes>(cells, dead);
+        }
+#endif // SSE2
+} // namespace Batch
+
+// Class methods
+        /*
+        Constructor for the BatchSolver class. Uses the widest instruction set supported by the CPU.
+        */
+        BatchSolver::BatchSolver()
+                : BatchSolver(detectInstructionSet())
+        {
+                LOG_TRACE("BatchSolver::BatchSolver() called");
+        }
+
+        /*
+        Constructor for the BatchSolver class.
+
+        @param instructionSet The instruction set of the propagation kernel.
+
+        @throw std::invalid_argument if the instruction set is not supported by the CPU.
+        */
+        BatchSolver::BatchSolver(InstructionSet instructionSet)
+                : instructionSet(instructionSet), lanes(1), kernel(Batch::propagateScalar)
+        {
+                LOG_TRACE("BatchSolver::BatchSolver(InstructionSet) called");
+
+                if (!isSupported(instructionSet))
+                {
+                        LOG_ERROR("Unsupported instruction set: {}", static_cast<int>(instructionSet));
+                        throw std::invalid_argument("Unsupported instruction set");
+                }
+
+#ifdef SUDOKU_BATCH_X86
+                switch (instructionSet)
+                {
+                        case InstructionSet::AVX2:
+                                lanes = 16;
+                                kernel = Batch::propagateAvx2;
+                                break;
+#ifdef __SSE2__
+                        case InstructionSet::SSE2:
+                                lanes = 8;
+                                kernel = Batch::propagateSse2;
+                                break;
+#endif // __SSE2__
+                        default:
+                                break;
+                }
+#endif // SUDOKU_BATCH_X86
+        }
+
+        /*
+        Destructor for the BatchSolver class.
+        */
+        BatchSolver::~BatchSolver()
+        {
+                LOG_TRACE("BatchSolver::~BatchSolver() called");
+        }
+// Solver methods
+        /*
+        Solves the puzzles in place.
+
+        @param grids The puzzles to solve, replaced by their solutions.
+        @param count The number of puzzles.
+        @param statuses Receives the result of every puzzle, SOLVED or UNSOLVABLE.
+
+        @return The number of solved puzzles.
+
+        @throw std::invalid_argument if a packed value is not in the value range.
+
+        @note Unsolvable puzzles are left untouched. The fixed cells are kept.
+        */
+        size_t BatchSolver::solve(PackedGrid* grids, size_t count, SolverStatus* statuses)
+        {
+                LOG_TRACE("BatchSolver::solve() called");
+
+                for (size_t start = 0; start < count; start += lanes)
+                {
+                        solveGroup(grids + start, std::min(lanes, count - start), statuses + start);
+                }
+
+                size_t solved = std::count(statuses, statuses + count, SolverStatus::SOLVED);
+
+                LOG_DEBUG("BatchSolver::solve() result: Solved {} of {} puzzles", solved, count);
+
+                return solved;
+        }
+
+        /*
+        Solves one group of puzzles, at most one per lane.
+
+        @param grids The puzzles to solve.
+        @param count The number of puzzles, the remaining lanes are left empty.
+        @param statuses Receives the result of every puzzle.
+        */
+        void BatchSolver::solveGroup(PackedGrid* grids, size_t count, SolverStatus* statuses)
+        {
+                gather(grids, count);
+                kernel(cells, dead);
+                scatter(grids, count, statuses);
+        }
+
+        /*
+        Interleaves the cells of the puzzles into the lanes.
+
+        @param grids The puzzles to read.
+        @param count The number of puzzles.
+
+        @throw std::invalid_argument if a packed value is not in the value range.
+        */
+        void BatchSolver::gather(const PackedGrid* grids, size_t count)
+        {
+                std::fill(cells, cells + 81 * lanes, 0);
+
+                for (size_t lane = 0; lane < count; lane++)
+                {
+                        for (size_t i = 0; i < 81; i++)
+                        {
+                                int value = (grids[lane].cells[i / 2] >> ((i % 2) * 4)) & 0x0F;
+
+                                if (value > 9)
+                                {
+                                        LOG_ERROR("Value out of range");
+                                        throw std::invalid_argument("Value out of range");
+                                }
+
+                                cells[i * lanes + lane] = value == 0 ? 0 : 1 << (value - 1);
+                        }
+                }
+        }
+
+        /*
+        Writes the propagated cells back and finishes the puzzles which need guessing.
+
+        @param grids The puzzles to write the solutions into.
+        @param count The number of puzzles.
+        @param statuses Receives the result of every puzzle.
+        */
+        void BatchSolver::scatter(PackedGrid* grids, size_t count, SolverStatus* statuses)
+        {
+                for (size_t lane = 0; lane < count; lane++)
+                {
+                        if (dead[lane] != 0)
+                        {
+                                statuses[lane] = SolverStatus::UNSOLVABLE;
+                                continue;
+                        }
+
+                        PackedGrid packed = grids[lane];
+                        bool complete = true;
+
+                        // The fixed bitmap is kept as it is, only the values are written
+                        packed.cells.fill(0);
+
+                        for (size_t i = 0; i < 81; i++)
+                        {
+                                uint16_t cell = cells[i * lanes + lane];
+
+                                if (cell == 0)
+                                {
+                                        complete = false;
+                                }
+                                else
+                                {
+                                        packed.cells[i / 2] |= lowestValue(cell) << ((i % 2) * 4);
+                                }
+                        }
+
+                        // The kernel checked every house, only the unfinished puzzles need a search
+                        if (complete)
+                        {
+                                grids[lane] = packed;
+                                statuses[lane] = SolverStatus::SOLVED;
+                                continue;
+                        }
+
+                        Grid grid;
+                        grid.unpack(packed);
+
+                        if (solver.solve(grid))
+                        {
+                                grid.pack(grids[lane]);
+                                statuses[lane] = SolverStatus::SOLVED;
+                        }
+                        else
+                        {
+                                statuses[lane] = SolverStatus::UNSOLVABLE;
+                        }
+                }
+        }
+// Utility methods
+        /*
+        Returns the instruction set used by the propagation kernel.
+
+        @return The instruction set.
+        */
+        InstructionSet BatchSolver::getInstructionSet() const noexcept
+        {
+                LOG_TRACE("BatchSolver::getInstructionSet() called");
+
+                return instructionSet;
+        }
+
+        /*
+        Returns the number of puzzles propagated in lockstep.
+
+        @return The number of lanes.
+        */
+        size_t BatchSolver::getLanes() const noexcept
+        {
+                LOG_TRACE("BatchSolver::getLanes() called");
+
+                return lanes;
+        }
+
+        /*
+        Detects the widest instruction set supported by the CPU.
+
+        @return The instruction set.
+        */
+        InstructionSet BatchSolver::detectInstructionSet() noexcept
+        {
+                LOG_TRACE("BatchSolver::detectInstructionSet() called");
+
+                if (isSupported(InstructionSet::AVX2))
+                {
+                        return InstructionSet::AVX2;
+                }
+
+                if (isSupported(InstructionSet::SSE2))
+                {
+                        return InstructionSet::SSE2;
+                }
+
+                return InstructionSet::SCALAR;
+        }
+
+        /*
+        Checks if the instruction set can be used on this CPU.
+
+        @param instructionSet The instruction set to check.
+
+        @return True if the instruction set is supported, false otherwise.
+        */
+        bool BatchSolver::isSupported(InstructionSet instructionSet) noexcept
+        {
+                LOG_TRACE("BatchSolver::isSupported() called");
+
+                switch (instructionSet)
+                {
+                        case InstructionSet::SCALAR:
+                                return true;
+#ifdef SUDOKU_BATCH_X86
+#ifdef __SSE2__
+                        case InstructionSet::SSE2:
+                                return true;
+#endif // __SSE2__
+                        case InstructionSet::AVX2:
+                                return __builtin_cpu_supports("avx2");
+#endif // SUDOKU_BATCH_X86
+                        default:
+                                return false;
+                }
+        }
+} // namespace Sudoku
@@ -0,0 +1,428 @@
+/*
+Date: 18/10/2026
+
+Canonicalizer maps a grid to a canonical representative of its class under the symmetries of
+the sudoku grid.
+*/
+
+#define LOG_SUBSYSTEM GENERATOR
+
+#include "canonicalizer.hpp"
+#include "grid.hpp"
+#include "macros.hpp"
+#include "random.hpp"
+#include "transformer.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace Sudoku
+{
+// Class methods
+        /*
+        Constructor for the Canonicalizer class.
+        */
+        Canonicalizer::Canonicalizer()
+        {
+                LOG_TRACE("Canonicalizer::Canonicalizer() called");
+        }
+
+        /*
+        Destructor for the Canonicalizer class.
+        */
+        Canonicalizer::~Canonicalizer()
+        {
+                LOG_TRACE("Canonicalizer::~Canonicalizer() called");
+        }
+// Canonicalizer methods
+        /*
+        Computes the canonical form of a solved grid or of a puzzle.
+
+        @param grid The grid, a puzzle is solved first.
+        @param result The grid to store the canonical form in, may be the grid itself.
+
+        @throw std::invalid_argument if the grid has no solution.
+
+        @note A puzzle with several solutions is mapped through the first solution found, which
+        is only canonical for puzzles with a unique solution.
+        */
+        void Canonicalizer::canonicalize(const Grid& grid, Grid& result)
+        {
+                LOG_TRACE("Canonicalizer::canonicalize() called");
+
+                if (grid.count(0) == 0)
+                {
+                        canonicalize(grid, grid, result);
+                        return;
+                }
+
+                Grid solution = grid;
+                if (!solver.solve(solution))
+                {
+                        LOG_ERROR("Canonicalizer::canonicalize() called with an unsolvable grid");
+                        throw std::invalid_argument("Unsolvable grid");
+                }
+
+                canonicalize(grid, solution, result);
+        }
+
+        /*
+        Computes the canonical form of a puzzle whose solution is known.
+
+        @param puzzle The puzzle, may also be the solution itself.
+        @param solution The solution of the puzzle.
+        @param result The grid to store the canonical form in, may be the puzzle or the solution.
+
+        @throw std::invalid_argument if the solution is not a solved grid.
+        */
+        void Canonicalizer::canonicalize(const Grid& puzzle, const Grid& solution, Grid& result)
+        {
+                LOG_TRACE("Canonicalizer::canonicalize(Grid, Grid) called");
+
+                if (!solution.isSolved())
+                {
+                        LOG_ERROR("Canonicalizer::canonicalize() called with an unsolved solution");
+                        throw std::invalid_argument("Solution is not solved");
+                }
+
+                search(solution);
+
+                // Automorphic solutions leave several transformations, the smallest puzzle wins. It is
+                // kept apart from result until the end, result may be the puzzle itself
+                std::array<uint8_t, 81> smallest;
+                Grid image;
+                Grid canonical;
+
+                for (size_t k = 0; k < optimal.size(); k++)
+                {
+                        Transformer::apply(optimal[k], puzzle, image);
+
+                        std::array<uint8_t, 81> values;
+                        for (size_t i = 0; i < 81; i++)
+                        {
+                                values[i] = image.getCellUnchecked(i);
+                        }
+
+                        if (k == 0 || values < smallest)
+                        {
+                                smallest = values;
+                                canonical = image;
+                        }
+                }
+
+                result = canonical;
+        }
+
+        /*
+        Computes the fingerprint of a grid, the hash of its canonical form. Equivalent grids have
+        the same fingerprint.
+
+        @param grid The grid, a puzzle is solved first.
+
+        @return The fingerprint.
+
+        @throw std::invalid_argument if the grid has no solution.
+        */
+        uint64_t Canonicalizer::fingerprint(const Grid& grid)
+        {
+                LOG_TRACE("Canonicalizer::fingerprint() called");
+
+                Grid canonical;
+                canonicalize(grid, canonical);
+
+                return hash(canonical);
+        }
+// Utility methods
+        /*
+        Hashes the values of a grid, the fixed flags are ignored. The values are packed 16 to a
+        word and every word is folded in with the SplitMix64 finalizer.
+
+        @param grid The grid.
+
+        @return The 64-bit hash.
+        */
+        uint64_t Canonicalizer::hash(const Grid& grid) noexcept
+        {
+                uint64_t hash = 0x9E3779B97F4A7C15ULL;
+                uint64_t word = 0;
+
+                for (size_t i = 0; i < 81; i++)
+                {
+                        word = (word << 4) | grid.getCellUnchecked(i);
+
+                        if (i % 16 == 15 || i == 80)
+                        {
+                                hash = Random::mix(hash ^ word) + i;
+                                word = 0;
+                        }
+                }
+
+                return hash;
+        }
+// Canonicalizer methods
+        /*
+        Finds the canonical grid of a solution and all the transformations which give it.
+
+        @param solution The solved grid.
+        */
+        void Canonicalizer::search(const Grid& solution)
+        {
+                for (size_t row = 0; row < 9; row++)
+                {
+                        for (size_t col = 0; col < 9; col++)
+                        {
+                                cells[0][row * 9 + col] = solution.getCellUnchecked(row * 9 + col);
+                                cells[1][col * 9 + row] = cells[0][row * 9 + col];
+                        }
+                }
+
+                bestRow.fill(UINT8_MAX);
+                candidates.clear();
+
+                // The top two rows always come from the same band
+                for (uint8_t transpose = 0; transpose < 2; transpose++)
+                {
+                        for (uint8_t first = 0; first < 9; first++)
+                        {
+                                for (uint8_t second = first / 3 * 3; second < first / 3 * 3 + 3; second++)
+                                {
+                                        if (second == first)
+                                        {
+                                                continue;
+                                        }
+
+                                        const uint8_t* top = &cells[transpose][first * 9];
+                                        const uint8_t* next = &cells[transpose][second * 9];
+                                        std::array<uint8_t, 10> columnOf;
+
+                                        for (uint8_t col = 0; col < 9; col++)
+                                        {
+                                                columnOf[top[col]] = col;
+                                        }
+                                        for (size_t col = 0; col < 9; col++)
+                                        {
+                                                successor[col] = columnOf[next[col]];
+                                        }
+
+                                        Columns columns;
+                                        columns.order.fill(-1);
+                                        columns.position.fill(-1);
+                                        columns.stackOf.fill(-1);
+                                        columns.stackAt.fill(-1);
+
+                                        current.transpose = transpose;
+                                        current.first = first;
+                                        current.second = second;
+                                        searchColumns(0, columns);
+                                }
+                        }
+                }
+
+                best.fill(UINT8_MAX);
+                optimal.clear();
+
+                for (const Candidate& candidate : candidates)
+                {
+                        complete(candidate);
+                }
+        }
+
+        /*
+        Depth first search for the column permutations giving the smallest second row.
+
+        With the top row relabeled to 123456789, the value at a new column of the second row is
+        one more than the new column of its successor. Whenever that column is still open the
+        successor is placed at the first place it may go, any other place would give a larger
+        value. Only the choice of the old column for the new column branches, and only between
+        choices giving the same value.
+
+        @param column The new column to fill.
+        @param columns The columns placed so far.
+        */
+        void Canonicalizer::searchColumns(size_t column, const Columns& columns)
+        {
+                if (column == 9)
+                {
+                        current.order = columns.order;
+                        candidates.push_back(current);
+                        return;
+                }
+
+                std::array<Columns, 9> options;
+                size_t count = 0;
+                uint8_t smallest = UINT8_MAX;
+                int stack = column / 3;
+
+                for (int old = 0; old < 9; old++)
+                {
+                        // The column may already hold the successor of an earlier one
+                        if (columns.order[column] >= 0 ? old != columns.order[column] : columns.position[old] >= 0)
+                        {
+                                continue;
+                        }
+                        if (columns.stackOf[stack] >= 0 ? columns.stackOf[stack] != old / 3 : columns.stackAt[old / 3] >= 0)
+                        {
+                                continue;
+                        }
+
+                        Columns next = columns;
+                        if (next.order[column] < 0)
+                        {
+                                place(next, column, old);
+                        }
+
+                        int target = successor[old];
+                        if (next.position[target] < 0)
+                        {
+                                int newStack = next.stackAt[target / 3];
+                                if (newStack < 0)
+                                {
+                                        newStack = std::find(next.stackOf.begin(), next.stackOf.end(), -1) - next.stackOf.begin();
+                                }
+
+                                int free = newStack * 3;
+                                while (next.order[free] >= 0)
+                                {
+                                        free++;
+                                }
+
+                                place(next, free, target);
+                        }
+
+                        uint8_t value = next.position[target] + 1;
+                        if (value < smallest)
+                        {
+                                smallest = value;
+                                count = 0;
+                        }
+                        if (value == smallest)
+                        {
+                                options[count++] = next;
+                        }
+                }
+
+                if (smallest > bestRow[column])
+                {
+                        return;
+                }
+
+                // A smaller prefix makes everything found so far worse
+                if (smallest < bestRow[column])
+                {
+                        bestRow[column] = smallest;
+                        std::fill(bestRow.begin() + column + 1, bestRow.end(), UINT8_MAX);
+                        candidates.clear();
+                }
+
+                for (size_t k = 0; k < count; k++)
+                {
+                        searchColumns(column + 1, options[k]);
+                }
+        }
+
+        /*
+        Completes a candidate to a full grid. The third row is the one left in the top band, the
+        rows of the other bands are sorted and the bands are ordered by their first row.
+
+        @param candidate The transposition, top rows and columns.
+        */
+        void Canonicalizer::complete(const Candidate& candidate)
+        {
+                const std::array<uint8_t, 81>& grid = cells[candidate.transpose];
+                std::array<uint8_t, 10> label;
+                std::array<int8_t, 9> position;
+
+                for (size_t col = 0; col < 9; col++)
+                {
+                        position[candidate.order[col]] = col;
+                }
+                label[0] = 0;
+                for (size_t col = 0; col < 9; col++)
+                {
+                        label[grid[candidate.first * 9 + col]] = position[col] + 1;
+                }
+
+                // Relabeled rows, indexed by old row
+                std::array<std::array<uint8_t, 9>, 9> rows;
+                for (size_t row = 0; row < 9; row++)
+                {
+                        for (size_t col = 0; col < 9; col++)
+                        {
+                                rows[row][col] = label[grid[row * 9 + candidate.order[col]]];
+                        }
+                }
+
+                size_t band = candidate.first / 3;
+                std::array<uint8_t, 9> order;
+                order[0] = candidate.first;
+                order[1] = candidate.second;
+                order[2] = band * 3 + 3 - candidate.first % 3 - candidate.second % 3;
+
+                std::array<std::array<uint8_t, 3>, 2> bands;
+                for (size_t k = 0, other = 0; other < 3; other++)
+                {
+                        if (other == band)
+                        {
+                                continue;
+                        }
+
+                        bands[k] = {static_cast<uint8_t>(other * 3), static_cast<uint8_t>(other * 3 + 1),
+                                static_cast<uint8_t>(other * 3 + 2)};
+                        std::sort(bands[k].begin(), bands[k].end(), [&rows](uint8_t a, uint8_t b)
+                        {
+                                return rows[a] < rows[b];
+                        });
+                        k++;
+                }
+                if (rows[bands[1][0]] < rows[bands[0][0]])
+                {
+                        std::swap(bands[0], bands[1]);
+                }
+                std::copy(bands[0].begin(), bands[0].end(), order.begin() + 3);
+                std::copy(bands[1].begin(), bands[1].end(), order.begin() + 6);
+
+                std::array<uint8_t, 81> result;
+                for (size_t row = 0; row < 9; row++)
+                {
+                        std::copy(rows[order[row]].begin(), rows[order[row]].end(), result.begin() + row * 9);
+                }
+
+                if (best < result)
+                {
+                        return;
+                }
+                if (result < best)
+                {
+                        best = result;
+                        optimal.clear();
+                }
+
+                Transformation transformation;
+                std::copy(label.begin(), label.end(), transformation.digits.begin());
+                for (size_t k = 0; k < 9; k++)
+                {
+                        transformation.rows[k] = candidate.transpose ? candidate.order[k] : order[k];
+                        transformation.cols[k] = candidate.transpose ? order[k] : candidate.order[k];
+                }
+                transformation.transpose = candidate.transpose;
+
+                optimal.push_back(transformation);
+        }
+
+        /*
+        Puts an old column at a new column and ties their stacks together.
+
+        @param columns The columns placed so far.
+        @param column The new column.
+        @param old The old column.
+        */
+        void Canonicalizer::place(Columns& columns, size_t column, size_t old) const noexcept
+        {
+                columns.order[column] = old;
+                columns.position[old] = column;
+                columns.stackOf[column / 3] = old / 3;
+                columns.stackAt[old / 3] = column / 3;
+        }
+} // namespace Sudoku
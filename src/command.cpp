@@ -4,6 +4,8 @@ Date: 13/11/2024
 Command class used to store commands for buttons in the scene. Following the command pattern.
 */
 
+#define LOG_SUBSYSTEM GUI
+
 #include "command.hpp"
 #include "macros.hpp"
 #include <functional>
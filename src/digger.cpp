@@ -0,0 +1,442 @@
+/*
+Date: 18/10/2026
+
+Digger turns a solved grid into a puzzle with a unique solution by removing cells.
+*/
+
+#define LOG_SUBSYSTEM GENERATOR
+
+#include "digger.hpp"
+#include "generator.hpp"
+#include "grid.hpp"
+#include "gridTables.hpp"
+#include "macros.hpp"
+#include "random.hpp"
+#include "solver.hpp"
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Sudoku
+{
+// Class methods
+        /*
+        Constructor for the Digger class.
+        */
+        Digger::Digger()
+        {
+                LOG_TRACE("Digger::Digger() called");
+        }
+
+        /*
+        Destructor for the Digger class.
+        */
+        Digger::~Digger()
+        {
+                LOG_TRACE("Digger::~Digger() called");
+        }
+// Digger methods
+        /*
+        Removes cells from a solved grid until it has the given number of givens, keeping the
+        solution unique.
+
+        @param grid The solved grid, turned into the puzzle.
+        @param givens The number of givens to leave.
+        @param random The random number generator choosing the order of the removals.
+        @param symmetry The pattern of the removed cells.
+
+        @return True if the number of givens was reached, false if the budget ran out. In that
+                case the grid holds the unique puzzle with the fewest givens found.
+        */
+        bool Digger::dig(Grid& grid, size_t givens, Random& random, Symmetry symmetry)
+        {
+                LOG_TRACE("Digger::dig() called");
+
+                size_t current = grid.size() - grid.count(0);
+
+                // The search needs the solution, a puzzle is solved first
+                solution = grid;
+                solves += current < grid.size();
+                if (current < grid.size() && !solver.solve(solution))
+                {
+                        LOG_ERROR("Digger::dig() called with an unsolvable grid");
+                        return false;
+                }
+
+                givenMask.reset();
+                for (size_t i = 0; i < grid.size(); i++)
+                {
+                        givenMask[i] = grid.getCellUnchecked(i) != 0;
+                }
+
+                makeUnits(symmetry, random);
+                unavoidable.clear();
+                target = givens;
+                checks = 0;
+                rejections = 0;
+                best = grid;
+                bestGivens = current;
+
+                bool result = search(grid, 0, current, std::bitset<81>());
+
+                if (!result)
+                {
+                        grid = best;
+                }
+
+                LOG_DEBUG("Digger::dig() result: {} givens after {} checks", result ? givens : bestGivens,
+                        checks);
+
+                return result;
+        }
+
+        /*
+        Generates a puzzle with the given number of givens and a unique solution. New solved grids
+        are generated until one can be dug down far enough.
+
+        @param puzzle The grid to store the puzzle in.
+        @param solution The grid to store the solution in.
+        @param givens The number of givens of the puzzle.
+        @param random The random number generator.
+        @param symmetry The pattern of the removed cells.
+
+        @return True if the number of givens was reached, or missed by no more than the tolerance,
+                false otherwise. If it was missed the puzzle with the fewest givens found is
+                returned.
+        */
+        bool Digger::generate(Grid& puzzle, Grid& solution, size_t givens, Random& random,
+                Symmetry symmetry)
+        {
+                LOG_TRACE("Digger::generate() called");
+
+                Grid bestPuzzle;
+                Grid bestSolution;
+                size_t fewest = SIZE_MAX;
+                solves = 0;
+
+                for (size_t attempt = 0; attempt < attempts; attempt++)
+                {
+                        generator.generate(solution, random);
+                        solves += generator.getSolves();
+                        puzzle = solution;
+
+                        if (dig(puzzle, givens, random, symmetry))
+                        {
+                                LOG_DEBUG("Digger::generate() took {} attempts", attempt + 1);
+                                return true;
+                        }
+
+                        if (bestGivens < fewest)
+                        {
+                                fewest = bestGivens;
+                                bestPuzzle = puzzle;
+                                bestSolution = solution;
+                        }
+                }
+
+                puzzle = bestPuzzle;
+                solution = bestSolution;
+
+                if (fewest > givens + tolerance)
+                {
+                        LOG_WARN("Digger::generate() could not reach {} givens, best was {}", givens, fewest);
+                        return false;
+                }
+
+                LOG_DEBUG("Digger::generate() settled for {} givens instead of {}", fewest, givens);
+
+                return true;
+        }
+// Setters
+        /*
+        Sets the number of uniqueness checks dig() may do before it gives up.
+
+        @param checks The number of checks.
+        */
+        void Digger::setBudget(size_t checks) noexcept
+        {
+                LOG_TRACE("Digger::setBudget() called");
+
+                budget = checks;
+        }
+
+        /*
+        Sets the number of solved grids generate() tries before it gives up.
+
+        @param attempts The number of attempts.
+        */
+        void Digger::setAttempts(size_t attempts) noexcept
+        {
+                LOG_TRACE("Digger::setAttempts() called");
+
+                this->attempts = std::max<size_t>(attempts, 1);
+        }
+
+        /*
+        Sets how many givens above the target generate() accepts as a success when no attempt
+        reaches the target.
+
+        @param givens The number of givens, 0 by default.
+        */
+        void Digger::setTolerance(size_t givens) noexcept
+        {
+                LOG_TRACE("Digger::setTolerance() called");
+
+                tolerance = givens;
+        }
+// Getters
+        /*
+        Returns the number of solver calls since the start of the last generate(), counting those
+        of the Generator filling the solved grids. A measure of the work which does not depend on
+        the machine.
+
+        @return The number of solver calls.
+        */
+        size_t Digger::getSolves() const noexcept
+        {
+                LOG_TRACE("Digger::getSolves() called");
+
+                return solves;
+        }
+// Digger methods
+        /*
+        Groups the cells into the units removed together and shuffles them.
+
+        @param symmetry The pattern of the removed cells.
+        @param random The random number generator.
+        */
+        void Digger::makeUnits(Symmetry symmetry, Random& random)
+        {
+                unitCount = 0;
+
+                for (size_t i = 0; i < 81; i++)
+                {
+                        size_t other = i;
+
+                        switch (symmetry)
+                        {
+                                case Symmetry::ROTATIONAL:
+                                        other = 80 - i;
+                                        break;
+                                case Symmetry::MIRROR:
+                                        other = Tables::ROW[i] * 9 + 8 - Tables::COL[i];
+                                        break;
+                                default:
+                                        break;
+                        }
+
+                        // Every pair is added once, from its smaller cell
+                        if (other < i)
+                        {
+                                continue;
+                        }
+
+                        units[unitCount++] = {static_cast<uint8_t>(i), static_cast<uint8_t>(other)};
+                }
+
+                random.shuffle(units.begin(), units.begin() + unitCount);
+
+                for (size_t k = 0; k < unitCount; k++)
+                {
+                        unitSizes[k] = units[k][0] == units[k][1] ? 1 : 2;
+                }
+        }
+
+        /*
+        Depth first search over the removals.
+
+        @param grid The current puzzle, unique.
+        @param unit The first unit which may still be removed.
+        @param givens The number of givens of the puzzle.
+        @param failed The units whose removal broke uniqueness on a puzzle with more givens.
+
+        @return True if the target was reached, the grid then holds the puzzle.
+        */
+        bool Digger::search(Grid& grid, size_t unit, size_t givens, std::bitset<81> failed)
+        {
+                if (givens <= target)
+                {
+                        return true;
+                }
+
+                // Not enough removable cells left to reach the target
+                if (lowerBound(unit, failed) > target)
+                {
+                        return false;
+                }
+
+                for (size_t k = unit; k < unitCount && checks < budget && rejections < budget * REJECTIONS_PER_CHECK; k++)
+                {
+                        size_t size = unitSizes[k];
+
+                        if (failed[k] || !givenMask[units[k][0]] || givens - size < target)
+                        {
+                                continue;
+                        }
+
+                        givenMask.reset(units[k][0]);
+                        givenMask.reset(units[k][1]);
+                        grid.setCellUnchecked(units[k][0], 0);
+                        grid.setCellUnchecked(units[k][1], 0);
+
+                        if (!isAvoidable() && isUnique(grid, k))
+                        {
+                                if (givens - size < bestGivens)
+                                {
+                                        best = grid;
+                                        bestGivens = givens - size;
+                                }
+
+                                if (search(grid, k + 1, givens - size, failed))
+                                {
+                                        return true;
+                                }
+                        }
+                        else
+                        {
+                                failed[k] = true;
+                        }
+
+                        givenMask.set(units[k][0]);
+                        givenMask.set(units[k][1]);
+                        grid.setCellUnchecked(units[k][1], solution.getCellUnchecked(units[k][1]));
+                        grid.setCellUnchecked(units[k][0], solution.getCellUnchecked(units[k][0]));
+                }
+
+                return false;
+        }
+
+        /*
+        Computes a lower bound of the givens left at the end of a branch of the search.
+
+        The givens of the units before unit and of the failed units are kept in the whole branch.
+        Every unavoidable set none of them hits needs another given, one given can only serve
+        sets which overlap, so every set disjoint from the ones counted before adds one.
+
+        @param unit The first unit which may still be removed.
+        @param failed The units which can not be removed.
+
+        @return The lower bound.
+        */
+        size_t Digger::lowerBound(size_t unit, const std::bitset<81>& failed) const noexcept
+        {
+                std::bitset<81> kept;
+
+                for (size_t k = 0; k < unitCount; k++)
+                {
+                        if ((k < unit || failed[k]) && givenMask[units[k][0]])
+                        {
+                                kept.set(units[k][0]);
+                                kept.set(units[k][1]);
+                        }
+                }
+
+                size_t bound = kept.count();
+                std::bitset<81> used;
+
+                for (const std::bitset<81>& set : unavoidable)
+                {
+                        if ((set & kept).none() && (set & used).none())
+                        {
+                                used |= set;
+                                bound++;
+                        }
+                }
+
+                return bound;
+        }
+
+        /*
+        Checks if the givens miss one of the known unavoidable sets. Such a puzzle has more than
+        one solution, which is found without running the solver.
+
+        @return True if an unavoidable set has no given, false otherwise.
+        */
+        bool Digger::isAvoidable() noexcept
+        {
+                for (const std::bitset<81>& set : unavoidable)
+                {
+                        if ((set & givenMask).none())
+                        {
+                                rejections++;
+                                return true;
+                        }
+                }
+
+                return false;
+        }
+
+        /*
+        Checks if the puzzle still has a unique solution after a unit was removed.
+
+        Since the puzzle was unique before, any other solution differs from the known one in the
+        removed cells. Those values are tried one by one and a solution found with one of them is
+        the second solution. This answers the same question as counting the solutions up to two,
+        but also yields the second solution.
+
+        @param grid The puzzle with the unit removed, restored on return.
+        @param unit The removed unit.
+
+        @return True if the solution is unique, false otherwise.
+        */
+        bool Digger::isUnique(Grid& grid, size_t unit)
+        {
+                bool unique = true;
+                checks++;
+
+                for (size_t j = 0; j < unitSizes[unit] && unique; j++)
+                {
+                        uint8_t cell = units[unit][j];
+                        int value = solution.getCellUnchecked(cell);
+                        uint16_t others = grid.candidatesUnchecked(cell) & ~(1 << (value - 1));
+
+                        while (others != 0 && unique)
+                        {
+                                Grid other = grid;
+                                other.setCellUnchecked(cell, lowestValue(others));
+                                others &= others - 1;
+
+                                solves++;
+                                if (solver.solve(other))
+                                {
+                                        learn(other);
+                                        unique = false;
+                                }
+                        }
+
+                        // The second cell of a pair is tried with the first one at its value
+                        grid.setCellUnchecked(cell, value);
+                }
+
+                grid.setCellUnchecked(units[unit][0], 0);
+                grid.setCellUnchecked(units[unit][1], 0);
+
+                return unique;
+        }
+
+        /*
+        Remembers the cells in which a second solution differs from the known one. They form an
+        unavoidable set, a unique puzzle must keep at least one of them as a given.
+
+        @param other The second solution.
+        */
+        void Digger::learn(const Grid& other)
+        {
+                if (unavoidable.size() >= MAX_UNAVOIDABLE)
+                {
+                        return;
+                }
+
+                std::bitset<81> set;
+
+                for (size_t i = 0; i < 81; i++)
+                {
+                        set[i] = other.getCellUnchecked(i) != solution.getCellUnchecked(i);
+                }
+
+                unavoidable.push_back(set);
+        }
+} // namespace Sudoku
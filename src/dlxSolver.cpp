@@ -0,0 +1,441 @@
+/*
+Date: 18/10/2026
+
+DlxSolver solves a sudoku grid as an exact cover problem using Knuth's Algorithm X with
+Dancing Links.
+*/
+
+#define LOG_SUBSYSTEM SOLVER
+
+#include "dlxSolver.hpp"
+#include "grid.hpp"
+#include "gridTables.hpp"
+#include "macros.hpp"
+#include <array>
+#include <vector>
+
+namespace Sudoku
+{
+// Class methods
+        /*
+        Constructor for the DlxSolver class. Builds the constraint matrix.
+        */
+        DlxSolver::DlxSolver()
+        {
+                LOG_TRACE("DlxSolver::DlxSolver() called");
+
+                build();
+        }
+
+        /*
+        Destructor for the DlxSolver class.
+        */
+        DlxSolver::~DlxSolver()
+        {
+                LOG_TRACE("DlxSolver::~DlxSolver() called");
+        }
+// Solver methods
+        /*
+        Solves the sudoku grid using Dancing Links.
+
+        @param grid The grid to solve.
+
+        @return True if the grid is solved, false otherwise.
+
+        @note Missing numbers are represented by zeros. Givens which contradict each other
+                make the grid unsolvable.
+        */
+        bool DlxSolver::solve(Grid& grid)
+        {
+                LOG_TRACE("DlxSolver::solve() called");
+
+                size_t givenCount = 0;
+                searchNodes = 0;
+                bool result = selectGivens(grid, givenCount) && search(grid);
+
+                // Restore the matrix for the next solve
+                deselectGivens(givenCount);
+
+                LOG_DEBUG("DlxSolver::solve() result: {} the puzzle",
+                        result ? "Successfully solved" : "Failed to solve");
+
+                return result;
+        }
+
+        /*
+        Counts the solutions of the sudoku grid, stopping early at limit.
+
+        @param grid The grid to count the solutions of.
+        @param limit The number of solutions after which counting stops.
+
+        @return The number of solutions, at most limit.
+
+        @note Use limit 2 to check if a puzzle has a unique solution.
+        */
+        int DlxSolver::countSolutions(const Grid& grid, int limit)
+        {
+                LOG_TRACE("DlxSolver::countSolutions() called");
+
+                if (limit <= 0)
+                {
+                        return 0;
+                }
+
+                size_t givenCount = 0;
+                searchNodes = 0;
+                int result = selectGivens(grid, givenCount) ? count(limit) : 0;
+
+                deselectGivens(givenCount);
+
+                return result;
+        }
+// Getters
+        /*
+        Returns the number of search nodes of the last solve() or countSolutions(), a measure of
+        the work which does not depend on the machine.
+
+        @return The number of nodes.
+        */
+        uint64_t DlxSolver::getNodes() const noexcept
+        {
+                LOG_TRACE("DlxSolver::getNodes() called");
+
+                return searchNodes;
+        }
+// Matrix methods
+        /*
+        Builds the constraint matrix into the node pool.
+        */
+        void DlxSolver::build()
+        {
+                LOG_TRACE("DlxSolver::build() called");
+
+                nodes.assign(NODES, Node{});
+                sizes.fill(0);
+                covered.fill(false);
+
+                // Headers form a circular list with the root
+                for (int header = 0; header <= COLUMNS; header++)
+                {
+                        Node& node = nodes[header];
+                        node.left = header == ROOT ? COLUMNS : header - 1;
+                        node.right = header == COLUMNS ? ROOT : header + 1;
+                        node.up = header;
+                        node.down = header;
+                        node.column = header - 1;
+                        node.row = -1;
+                }
+
+                int next = 1 + COLUMNS;
+
+                for (int row = 0; row < ROWS; row++)
+                {
+                        int cell = row / 9;
+                        int value = row % 9;
+                        std::array<int, 4> columns = {
+                                cell,
+                                81 + Tables::ROW[cell] * 9 + value,
+                                162 + Tables::COL[cell] * 9 + value,
+                                243 + Tables::BOX[cell] * 9 + value
+                        };
+
+                        rowStart[row] = next;
+
+                        for (int k = 0; k < 4; k++)
+                        {
+                                int index = next + k;
+                                int header = columns[k] + 1;
+                                Node& node = nodes[index];
+
+                                // Link into the row
+                                node.left = next + (k + 3) % 4;
+                                node.right = next + (k + 1) % 4;
+
+                                // Link at the bottom of the column
+                                node.up = nodes[header].up;
+                                node.down = header;
+                                nodes[nodes[header].up].down = index;
+                                nodes[header].up = index;
+
+                                node.column = columns[k];
+                                node.row = row;
+                                sizes[columns[k]]++;
+                        }
+
+                        next += 4;
+                }
+        }
+
+        /*
+        Removes a column from the header list and all the rows intersecting it from the matrix.
+
+        @param column The column to cover.
+        */
+        void DlxSolver::cover(int column) noexcept
+        {
+                int header = column + 1;
+
+                nodes[nodes[header].right].left = nodes[header].left;
+                nodes[nodes[header].left].right = nodes[header].right;
+                covered[column] = true;
+
+                for (int i = nodes[header].down; i != header; i = nodes[i].down)
+                {
+                        for (int j = nodes[i].right; j != i; j = nodes[j].right)
+                        {
+                                nodes[nodes[j].down].up = nodes[j].up;
+                                nodes[nodes[j].up].down = nodes[j].down;
+                                sizes[nodes[j].column]--;
+                        }
+                }
+        }
+
+        /*
+        Reverts cover() of a column. Columns must be uncovered in the reverse order.
+
+        @param column The column to uncover.
+        */
+        void DlxSolver::uncover(int column) noexcept
+        {
+                int header = column + 1;
+
+                for (int i = nodes[header].up; i != header; i = nodes[i].up)
+                {
+                        for (int j = nodes[i].left; j != i; j = nodes[j].left)
+                        {
+                                sizes[nodes[j].column]++;
+                                nodes[nodes[j].down].up = j;
+                                nodes[nodes[j].up].down = j;
+                        }
+                }
+
+                nodes[nodes[header].right].left = header;
+                nodes[nodes[header].left].right = header;
+                covered[column] = false;
+        }
+
+        /*
+        Puts a row into the partial solution by covering all of its columns.
+
+        @param row The matrix row to select.
+
+        @return True if the row could be selected, false if it conflicts with an already selected row.
+        */
+        bool DlxSolver::selectRow(int row) noexcept
+        {
+                int start = rowStart[row];
+
+                // A covered column means a selected row already satisfies the constraint
+                for (int k = 0; k < 4; k++)
+                {
+                        if (covered[nodes[start + k].column])
+                        {
+                                return false;
+                        }
+                }
+
+                int node = start;
+                do
+                {
+                        cover(nodes[node].column);
+                        node = nodes[node].right;
+                }
+                while (node != start);
+
+                return true;
+        }
+
+        /*
+        Reverts selectRow(). Rows must be deselected in the reverse order.
+
+        @param row The matrix row to deselect.
+        */
+        void DlxSolver::deselectRow(int row) noexcept
+        {
+                int start = rowStart[row];
+
+                int node = nodes[start].left;
+                while (node != start)
+                {
+                        uncover(nodes[node].column);
+                        node = nodes[node].left;
+                }
+
+                uncover(nodes[start].column);
+        }
+
+        /*
+        Selects the rows of all the given cells of the grid.
+
+        @param grid The grid to read the givens from.
+        @param givenCount Set to the number of selected rows.
+
+        @return True if all the givens could be selected, false if they conflict.
+
+        @note deselectGivens() must be called with the count even if the selection failed.
+        */
+        bool DlxSolver::selectGivens(const Grid& grid, size_t& givenCount) noexcept
+        {
+                givenCount = 0;
+
+                for (size_t i = 0; i < grid.size(); i++)
+                {
+                        int value = grid.getCellUnchecked(i);
+
+                        if (value != 0)
+                        {
+                                int row = i * 9 + value - 1;
+
+                                if (!selectRow(row))
+                                {
+                                        return false;
+                                }
+
+                                givens[givenCount++] = row;
+                        }
+                }
+
+                return true;
+        }
+
+        /*
+        Deselects the rows selected by selectGivens() in the reverse order.
+
+        @param givenCount The number of selected rows.
+        */
+        void DlxSolver::deselectGivens(size_t givenCount) noexcept
+        {
+                while (givenCount > 0)
+                {
+                        deselectRow(givens[--givenCount]);
+                }
+        }
+// Search methods
+        /*
+        Recursive Algorithm X search. The found solution is written into the grid while unwinding
+        and the matrix is restored in both cases.
+
+        @param grid The grid to write the solution into.
+
+        @return True if a solution was found, false otherwise.
+        */
+        bool DlxSolver::search(Grid& grid)
+        {
+                searchNodes++;
+
+                // Every constraint is satisfied
+                if (nodes[ROOT].right == ROOT)
+                {
+                        return true;
+                }
+
+                int column = chooseColumn();
+                if (sizes[column] == 0)
+                {
+                        return false;
+                }
+
+                int header = column + 1;
+                bool found = false;
+
+                cover(column);
+
+                for (int i = nodes[header].down; i != header && !found; i = nodes[i].down)
+                {
+                        for (int j = nodes[i].right; j != i; j = nodes[j].right)
+                        {
+                                cover(nodes[j].column);
+                        }
+
+                        found = search(grid);
+
+                        for (int j = nodes[i].left; j != i; j = nodes[j].left)
+                        {
+                                uncover(nodes[j].column);
+                        }
+
+                        if (found)
+                        {
+                                grid.setCellUnchecked(nodes[i].row / 9, nodes[i].row % 9 + 1);
+                        }
+                }
+
+                uncover(column);
+
+                return found;
+        }
+
+        /*
+        Recursive Algorithm X search which counts the solutions instead of recording them.
+
+        @param limit The number of solutions after which counting stops.
+
+        @return The number of solutions found, at most limit.
+        */
+        int DlxSolver::count(int limit)
+        {
+                searchNodes++;
+
+                if (nodes[ROOT].right == ROOT)
+                {
+                        return 1;
+                }
+
+                int column = chooseColumn();
+                if (sizes[column] == 0)
+                {
+                        return 0;
+                }
+
+                int header = column + 1;
+                int found = 0;
+
+                cover(column);
+
+                for (int i = nodes[header].down; i != header && found < limit; i = nodes[i].down)
+                {
+                        for (int j = nodes[i].right; j != i; j = nodes[j].right)
+                        {
+                                cover(nodes[j].column);
+                        }
+
+                        found += count(limit - found);
+
+                        for (int j = nodes[i].left; j != i; j = nodes[j].left)
+                        {
+                                uncover(nodes[j].column);
+                        }
+                }
+
+                uncover(column);
+
+                return found;
+        }
+
+        /*
+        Chooses the column with the fewest rows left to keep the branching factor small.
+
+        @return The column to branch on.
+        */
+        int DlxSolver::chooseColumn() const noexcept
+        {
+                int best = nodes[nodes[ROOT].right].column;
+
+                for (int header = nodes[ROOT].right; header != ROOT; header = nodes[header].right)
+                {
+                        int column = nodes[header].column;
+
+                        if (sizes[column] < sizes[best])
+                        {
+                                best = column;
+
+                                if (sizes[best] <= 1)
+                                {
+                                        break;
+                                }
+                        }
+                }
+
+                return best;
+        }
+} // namespace Sudoku
@@ -4,14 +4,25 @@ Date: 10/11/2024
 Game handler makes the connection between the GUI and the game logic.
 */
 
+#define LOG_SUBSYSTEM GUI
+
+#include "digger.hpp"
 #include "gameHandler.hpp"
-#include "generator.hpp"
 #include "macros.hpp"
+#include "generatorPool.hpp"
 #include "grid.hpp"
+#include "pregenerator.hpp"
+#include "puzzleBank.hpp"
+#include "random.hpp"
 #include "solver.hpp"
-#include <algorithm>
+#include "tracer.hpp"
+#include "transformer.hpp"
+#include <array>
 #include <chrono>
-#include <random>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
 
 namespace Sudoku
 {
@@ -19,11 +30,19 @@ namespace Sudoku
         /*
         Constructor.
 
-        @note Does not initialize the grid with a new game.
+        @note Does not initialize the grid with a new game. Opens the puzzle bank at BANK_PATH
+        if there is one.
         */
         GameHandler::GameHandler()
         {
                 LOG_TRACE("GameHandler::GameHandler() called");
+
+                digger.setTolerance(GIVENS_TOLERANCE);
+
+                if (std::filesystem::exists(BANK_PATH))
+                {
+                        openBank(BANK_PATH);
+                }
         }
 
         /*
@@ -35,49 +54,115 @@ namespace Sudoku
         }
 // Game handler methods
         /*
-        Generates a new game with the given difficulty.
+        Generates a new game with the given difficulty from a fresh seed. A puzzle generated in the
+        background is used if one is ready.
 
         @param difficulty The difficulty of the game.
         */
         void GameHandler::newGame(Difficulty difficulty)
         {
                 LOG_TRACE("GameHandler::newGame() called");
+                TRACE_SCOPE("GameHandler::newGame");
 
-                // Set the difficulty
-                this->difficulty = difficulty;
+                // The bank is faster still, the background puzzles are only used without it
+                GeneratedPuzzle puzzle;
+                if (bank.count(difficulty) == 0 && pregenerator.pop(difficulty, puzzle))
+                {
+                        grid.unpack(puzzle.puzzle);
+                        solved.unpack(puzzle.solution);
+                        startGame(difficulty, puzzle.seed);
+                        return;
+                }
 
-                // Generate a new grid
-                generator.generate(grid);
+                newGame(difficulty, Random::randomSeed());
+        }
 
-                // Set the solved grid
-                solved = grid;
+        /*
+        Generates a new game with the given difficulty from a seed. The same seed and difficulty
+        always give the same game.
 
-                // Remove cells based on the difficulty
-                size_t cells = static_cast<size_t>(difficulty);
-                grid.setZero(grid.size() - cells);
+        @param difficulty The difficulty of the game.
+        @param seed The seed of the game.
+        */
+        void GameHandler::newGame(Difficulty difficulty, uint64_t seed)
+        {
+                LOG_TRACE("GameHandler::newGame(uint64_t) called");
+                TRACE_SCOPE("GameHandler::newGame(seed)");
 
-                // Reset attributes
-                score = 0;
-                selectedCell = -1;
-                selectedCellValue = -1;
-                selectedNumber = -1;
-                hintsUsed = 0;
-                mistakes = 0;
-                notesMode = false;
-                notes.reset();
-                time.zero();
-                cheat = false;
+                // The puzzle comes from the seed, see GeneratorPool::generateOne()
+                random.seed(seed);
 
-                #ifdef DEVELOPMENT
-                // Log the current grid and solved grid for debugging
-                Sudoku::Grid grid;
-                getGrid(grid);
-                LOG_DEBUG("Current grid:");
-                grid.print();
-                getGrid(grid, true);
-                LOG_DEBUG("Solved grid:");
-                grid.print();
-                #endif // DEVELOPMENT
+                // Pick a puzzle from the bank, it only has to be generated if the bank has none
+                if (const BankRecord* record = bank.pick(difficulty, random))
+                {
+                        // Every record stands for all its symmetric variants
+                        Transformation transformation = Transformer::random(random);
+                        Grid stored;
+
+                        stored.unpack(record->puzzle);
+                        Transformer::apply(transformation, stored, grid);
+                        stored.unpack(record->solution);
+                        Transformer::apply(transformation, stored, solved);
+                }
+                else
+                {
+                        // If the number of givens of the difficulty is not reached the puzzle with
+                        // the fewest givens found is used, quietly if it is still in the band
+                        size_t givens = static_cast<size_t>(difficulty);
+                        digger.generate(grid, solved, givens, random);
+                }
+
+                startGame(difficulty, seed);
+        }
+
+        /*
+        Starts generating puzzles in the background, except for the difficulties the bank has.
+        */
+        void GameHandler::startPregenerating()
+        {
+                LOG_TRACE("GameHandler::startPregenerating() called");
+
+                std::array<bool, 4> levels;
+                for (size_t level = 0; level < LEVELS.size(); level++)
+                {
+                        levels[level] = bank.count(LEVELS[level]) == 0;
+                }
+
+                pregenerator.start(levels);
+        }
+
+        /*
+        Stops generating puzzles in the background and waits for the producer thread.
+        */
+        void GameHandler::stopPregenerating() noexcept
+        {
+                LOG_TRACE("GameHandler::stopPregenerating() called");
+
+                pregenerator.stop();
+        }
+
+        /*
+        Opens a puzzle bank, new games are picked from it instead of generated.
+
+        @param path The path of the bank file.
+
+        @return True if the bank was opened, false if the games are still generated.
+        */
+        bool GameHandler::openBank(const std::string& path)
+        {
+                LOG_TRACE("GameHandler::openBank() called");
+
+                try
+                {
+                        bank.open(path);
+                }
+                catch (const std::runtime_error& error)
+                {
+                        LOG_WARN("Puzzle bank not used: {}", error.what());
+                        return false;
+                }
+
+                return true;
         }
 
         /*
@@ -135,8 +220,7 @@ namespace Sudoku
                 }
                 else
                 {
-                        std::shuffle(unsolvedCells.begin(), unsolvedCells.end(),
-                                std::mt19937{std::random_device{}()});
+                        random.shuffle(unsolvedCells.begin(), unsolvedCells.end());
 
                         for (size_t i = 0, index; i < cells; i++)
                         {
@@ -191,6 +275,51 @@ namespace Sudoku
                 return grid.isSolved() && mistakes < 3;
         }
 // Game handler methods
+        /*
+        Starts the game on the puzzle in grid and solved. The givens are marked as fixed, whether
+        the puzzle was dug, picked from the bank or generated in the background.
+
+        @param difficulty The difficulty of the game.
+        @param seed The seed of the game.
+        */
+        void GameHandler::startGame(Difficulty difficulty, uint64_t seed)
+        {
+                LOG_TRACE("GameHandler::startGame() called");
+
+                grid.fixGivens();
+
+                // Set the difficulty
+                this->difficulty = difficulty;
+
+                // The hints come from the seed as well, no matter how the puzzle was made
+                this->seed = seed;
+                random.seed(Random::mix(seed));
+
+                // Reset attributes
+                score = 0;
+                selectedCell = -1;
+                selectedCellValue = -1;
+                selectedNumber = -1;
+                hintsUsed = 0;
+                mistakes = 0;
+                notesMode = false;
+                notes.reset();
+                time.zero();
+                cheat = false;
+
+                #ifdef DEVELOPMENT
+                // Log the current grid and solved grid for debugging
+                Sudoku::Grid grid;
+                getGrid(grid);
+                LOG_DEBUG("Seed: {}", seed);
+                LOG_DEBUG("Current grid:");
+                grid.print();
+                getGrid(grid, true);
+                LOG_DEBUG("Solved grid:");
+                grid.print();
+                #endif // DEVELOPMENT
+        }
+
         /*
         Updates the score based on the difficulty and time.
 
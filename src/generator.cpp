@@ -4,13 +4,14 @@ Date: 10/11/2024
 Generator is class which generates a new sudoku grid.
 */
 
+#define LOG_SUBSYSTEM GENERATOR
+
 #include "generator.hpp"
 #include "macros.hpp"
 #include "grid.hpp"
+#include "random.hpp"
 #include "solver.hpp"
-#include <algorithm>
 #include <array>
-#include <random>
 
 namespace Sudoku
 {
@@ -40,25 +41,57 @@ namespace Sudoku
         {
                 LOG_TRACE("Generator::generate() called");
 
+                // Seeded once per thread instead of once per call
+                thread_local Random random;
+                generate(grid, random);
+        }
+
+        /*
+        Generates a new, filled sudoku grid using the given random number generator. The same
+        generator state always gives the same grid.
+
+        @param grid The grid to generate.
+        @param random The random number generator.
+        */
+        void Generator::generate(Grid& grid, Random& random)
+        {
+                LOG_TRACE("Generator::generate(Random&) called");
+
                 // Clear the grid
                 grid.clear();
 
                 Solver solver;
+                solves = 0;
                 // This ensures that the grid is validly filled
                 do
                 {
                         // Fill the diagonal boxes with random numbers
-                        Generator::randomlyFillDiagonalBoxes(grid);
+                        Generator::randomlyFillDiagonalBoxes(grid, random);
+                        solves++;
                 }
                 while (!solver.solve(grid));
         }
 
+        /*
+        Returns the number of solver calls of the last generate(), one per try of the diagonal
+        boxes.
+
+        @return The number of solver calls.
+        */
+        size_t Generator::getSolves() const noexcept
+        {
+                LOG_TRACE("Generator::getSolves() called");
+
+                return solves;
+        }
+
         /*
         Fills the diagonal boxes of the grid with random numbers.
 
         @param grid The grid to fill.
+        @param random The random number generator.
         */
-        void Generator::randomlyFillDiagonalBoxes(Grid& grid)
+        void Generator::randomlyFillDiagonalBoxes(Grid& grid, Random& random)
         {
                 LOG_TRACE("Generator::randomlyFillDiagonalBoxes() called");
 
@@ -69,8 +102,7 @@ namespace Sudoku
                 for (int i = 0; i < 3; i++)
                 {
                         // Shuffle the values
-                        std::shuffle(values.begin(), values.end(),
-                                std::mt19937(std::random_device()()));
+                        random.shuffle(values.begin(), values.end());
 
                         // Copy the values to the box array
                         boxArray = values;
@@ -0,0 +1,133 @@
+/*
+Date: 18/10/2026
+
+GeneratorPool generates many puzzles in parallel on a work stealing ThreadPool.
+*/
+
+#define LOG_SUBSYSTEM GENERATOR
+
+#include "difficulty.hpp"
+#include "digger.hpp"
+#include "generatorPool.hpp"
+#include "grid.hpp"
+#include "macros.hpp"
+#include "random.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Sudoku
+{
+// Class methods
+        /*
+        Constructor for the GeneratorPool class.
+
+        @param threads The number of threads, 0 uses one per hardware thread.
+        */
+        GeneratorPool::GeneratorPool(size_t threads)
+                : pool(threads)
+        {
+                LOG_TRACE("GeneratorPool::GeneratorPool() called");
+        }
+
+        /*
+        Destructor for the GeneratorPool class.
+        */
+        GeneratorPool::~GeneratorPool()
+        {
+                LOG_TRACE("GeneratorPool::~GeneratorPool() called");
+        }
+// Generator methods
+        /*
+        Generates puzzles in parallel.
+
+        @param count The number of puzzles.
+        @param difficulty The difficulty of the puzzles.
+        @param masterSeed The seed all the puzzle seeds are derived from.
+
+        @return The puzzles, puzzle k is always generateOne(difficulty, puzzleSeed(masterSeed, k)).
+        */
+        std::vector<GeneratedPuzzle> GeneratorPool::generate(size_t count, Difficulty difficulty,
+                uint64_t masterSeed)
+        {
+                LOG_TRACE("GeneratorPool::generate() called");
+
+                std::vector<GeneratedPuzzle> puzzles(count);
+
+                // Every task writes its own range, so the tasks share nothing
+                for (size_t start = 0; start < count; start += CHUNK)
+                {
+                        size_t end = std::min(start + CHUNK, count);
+
+                        pool.submit([&puzzles, difficulty, masterSeed, start, end]
+                        {
+                                for (size_t k = start; k < end; k++)
+                                {
+                                        puzzles[k] = generateOne(difficulty, puzzleSeed(masterSeed, k));
+                                }
+                        });
+                }
+
+                pool.wait();
+
+                LOG_DEBUG("GeneratorPool::generate() generated {} puzzles", count);
+
+                return puzzles;
+        }
+
+        /*
+        Generates a single puzzle from its seed.
+
+        @param difficulty The difficulty of the puzzle.
+        @param seed The seed of the puzzle.
+
+        @return The puzzle.
+        */
+        GeneratedPuzzle GeneratorPool::generateOne(Difficulty difficulty, uint64_t seed)
+        {
+                Random random(seed);
+                Digger digger;
+                Grid grid;
+                Grid solution;
+                GeneratedPuzzle puzzle;
+
+                // Dig a unique puzzle based on the difficulty, the way GameHandler::newGame() does
+                size_t givens = static_cast<size_t>(difficulty);
+                digger.setTolerance(GIVENS_TOLERANCE);
+                digger.generate(grid, solution, givens, random);
+                solution.pack(puzzle.solution);
+
+                grid.fixGivens();
+                grid.pack(puzzle.puzzle);
+                puzzle.seed = seed;
+
+                return puzzle;
+        }
+// Utility methods
+        /*
+        Returns the number of threads generating the puzzles.
+
+        @return The number of threads.
+        */
+        size_t GeneratorPool::getThreads() const noexcept
+        {
+                LOG_TRACE("GeneratorPool::getThreads() called");
+
+                return pool.size();
+        }
+
+        /*
+        Derives the seed of a puzzle from the master seed using SplitMix64. Neighbouring indices
+        give unrelated seeds.
+
+        @param masterSeed The master seed.
+        @param index The index of the puzzle.
+
+        @return The seed of the puzzle.
+        */
+        uint64_t GeneratorPool::puzzleSeed(uint64_t masterSeed, size_t index) noexcept
+        {
+                return Random::mix(masterSeed + (index + 1) * 0x9E3779B97F4A7C15ULL);
+        }
+} // namespace Sudoku
@@ -0,0 +1,888 @@
+/*
+Date: 18/10/2026
+
+Grader rates how hard a puzzle is for a human by solving it with human techniques only.
+*/
+
+#define LOG_SUBSYSTEM SOLVER
+
+#include "grader.hpp"
+#include "grid.hpp"
+#include "gridTables.hpp"
+#include "macros.hpp"
+#include "solver.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+        /*
+        Returns every 9-bit mask with the given number of bits set, in increasing order.
+        */
+        template <size_t Count>
+        constexpr std::array<uint16_t, Count> makeCombinations(int size)
+        {
+                std::array<uint16_t, Count> combinations{};
+                size_t count = 0;
+
+                for (uint16_t mask = 0; mask < 512; mask++)
+                {
+                        int bits = 0;
+
+                        for (int bit = 0; bit < 9; bit++)
+                        {
+                                bits += (mask >> bit) & 1;
+                        }
+
+                        if (bits == size)
+                        {
+                                combinations[count++] = mask;
+                        }
+                }
+
+                return combinations;
+        }
+
+        constexpr std::array<uint16_t, 36> PAIRS = makeCombinations<36>(2);     // Every choice of 2 out of 9
+        constexpr std::array<uint16_t, 84> TRIPLES = makeCombinations<84>(3);   // Every choice of 3 out of 9
+
+        // Weight of every technique, indexed by Technique
+        constexpr std::array<int, 15> WEIGHTS = {0, 12, 23, 26, 28, 30, 32, 34, 36, 38, 40, 42, 66, 70, 100};
+
+        /*
+        Looks for subsets of size masks whose union has exactly size bits. Naked subsets, hidden
+        subsets and fish are all this search, on cells, values or lines.
+
+        @param masks The 9 masks, a zero mask is never part of a subset.
+        @param size The size of the subsets, 2 or 3.
+        @param eliminate Called with the chosen indices and the union of their masks, returns
+                true if it eliminated a candidate.
+
+        @return True as soon as a subset eliminated a candidate, false otherwise.
+        */
+        template <typename Eliminate>
+        bool findSubset(const std::array<uint16_t, 9>& masks, int size, Eliminate eliminate)
+        {
+                const uint16_t* combinations = size == 2 ? PAIRS.data() : TRIPLES.data();
+                size_t count = size == 2 ? PAIRS.size() : TRIPLES.size();
+
+                for (size_t k = 0; k < count; k++)
+                {
+                        uint16_t members = 0;
+                        bool complete = true;
+
+                        for (uint16_t bits = combinations[k]; bits != 0; bits &= bits - 1)
+                        {
+                                uint16_t mask = masks[Sudoku::lowestValue(bits) - 1];
+
+                                if (mask == 0)
+                                {
+                                        complete = false;
+                                        break;
+                                }
+
+                                members |= mask;
+                        }
+
+                        if (complete && Sudoku::popCount(members) == size && eliminate(combinations[k], members))
+                        {
+                                return true;
+                        }
+                }
+
+                return false;
+        }
+
+        /*
+        Checks if two different cells share a house.
+        */
+        inline bool isPeer(size_t a, size_t b) noexcept
+        {
+                using namespace Sudoku::Tables;
+
+                return a != b && (ROW[a] == ROW[b] || COL[a] == COL[b] || BOX[a] == BOX[b]);
+        }
+} // namespace
+
+namespace Sudoku
+{
+// Class methods
+        /*
+        Constructor for the Grader class.
+        */
+        Grader::Grader()
+        {
+                LOG_TRACE("Grader::Grader() called");
+        }
+
+        /*
+        Destructor for the Grader class.
+        */
+        Grader::~Grader()
+        {
+                LOG_TRACE("Grader::~Grader() called");
+        }
+// Grader methods
+        /*
+        Grades a puzzle by solving it with human techniques.
+
+        @param grid The puzzle.
+
+        @return The hardest technique needed and the score of the puzzle.
+
+        @throw std::invalid_argument if the grid has a value twice in a house.
+        */
+        Grade Grader::grade(const Grid& grid)
+        {
+                LOG_TRACE("Grader::grade() called");
+
+                if (!grid.isValid())
+                {
+                        LOG_ERROR("Grader::grade() called with an invalid grid");
+                        throw std::invalid_argument("Invalid grid");
+                }
+
+                empty = 0;
+                for (size_t i = 0; i < 81; i++)
+                {
+                        values[i] = grid.getCellUnchecked(i);
+                        candidates[i] = values[i] == 0 ? grid.candidatesUnchecked(i) : 0;
+                        empty += values[i] == 0;
+                }
+
+                Grade result;
+
+                while (empty > 0)
+                {
+                        Technique technique = step();
+
+                        if (technique > result.hardest)
+                        {
+                                result.hardest = technique;
+                        }
+                        result.score += getWeight(technique);
+
+                        if (technique == Technique::GUESS)
+                        {
+                                break;
+                        }
+
+                        result.steps++;
+                }
+
+                result.solved = empty == 0;
+
+                // Count the guesses a search needs from where the techniques got stuck
+                if (!result.solved)
+                {
+                        Grid rest;
+                        getGrid(rest);
+                        solver.solve(rest);
+                        result.guesses = solver.getStats().guesses;
+                }
+
+                return result;
+        }
+// Getters
+        /*
+        Returns the grid as far as the last graded puzzle was solved.
+
+        @param grid The grid to store the values in.
+        */
+        void Grader::getGrid(Grid& grid) const
+        {
+                LOG_TRACE("Grader::getGrid() called");
+
+                for (size_t i = 0; i < 81; i++)
+                {
+                        grid.setCellUnchecked(i, values[i]);
+                }
+        }
+// Utility methods
+        /*
+        Returns the weight of a technique, how much one use of it adds to the score.
+
+        @param technique The technique.
+
+        @return The weight.
+        */
+        int Grader::getWeight(Technique technique) noexcept
+        {
+                return WEIGHTS[static_cast<size_t>(technique)];
+        }
+
+        /*
+        Returns the name of a technique.
+
+        @param technique The technique.
+
+        @return The name.
+        */
+        const char* Grader::getName(Technique technique) noexcept
+        {
+                switch (technique)
+                {
+                        case Technique::HIDDEN_SINGLE:
+                                return "Hidden Single";
+                        case Technique::NAKED_SINGLE:
+                                return "Naked Single";
+                        case Technique::POINTING:
+                                return "Pointing";
+                        case Technique::BOX_LINE:
+                                return "Box/Line Reduction";
+                        case Technique::NAKED_PAIR:
+                                return "Naked Pair";
+                        case Technique::X_WING:
+                                return "X-Wing";
+                        case Technique::HIDDEN_PAIR:
+                                return "Hidden Pair";
+                        case Technique::NAKED_TRIPLE:
+                                return "Naked Triple";
+                        case Technique::SWORDFISH:
+                                return "Swordfish";
+                        case Technique::HIDDEN_TRIPLE:
+                                return "Hidden Triple";
+                        case Technique::XY_WING:
+                                return "XY-Wing";
+                        case Technique::X_CHAIN:
+                                return "X-Chain";
+                        case Technique::XY_CHAIN:
+                                return "XY-Chain";
+                        case Technique::GUESS:
+                                return "Guess";
+                        default:
+                                return "None";
+                }
+        }
+// Grader methods
+        /*
+        Applies the easiest technique which makes progress.
+
+        @return The technique applied, GUESS if none of them made progress.
+        */
+        Technique Grader::step()
+        {
+                if (hiddenSingle())
+                {
+                        return Technique::HIDDEN_SINGLE;
+                }
+                if (nakedSingle())
+                {
+                        return Technique::NAKED_SINGLE;
+                }
+                if (pointing())
+                {
+                        return Technique::POINTING;
+                }
+                if (boxLine())
+                {
+                        return Technique::BOX_LINE;
+                }
+                if (nakedSubset(2))
+                {
+                        return Technique::NAKED_PAIR;
+                }
+                if (fish(2))
+                {
+                        return Technique::X_WING;
+                }
+                if (hiddenSubset(2))
+                {
+                        return Technique::HIDDEN_PAIR;
+                }
+                if (nakedSubset(3))
+                {
+                        return Technique::NAKED_TRIPLE;
+                }
+                if (fish(3))
+                {
+                        return Technique::SWORDFISH;
+                }
+                if (hiddenSubset(3))
+                {
+                        return Technique::HIDDEN_TRIPLE;
+                }
+                if (xyWing())
+                {
+                        return Technique::XY_WING;
+                }
+                if (xChain())
+                {
+                        return Technique::X_CHAIN;
+                }
+                if (xyChain())
+                {
+                        return Technique::XY_CHAIN;
+                }
+
+                return Technique::GUESS;
+        }
+
+        /*
+        Places a value and removes it from the candidates of the peers.
+
+        @param cell The cell.
+        @param value The value in the range [1, 9].
+        */
+        void Grader::place(size_t cell, int value) noexcept
+        {
+                uint16_t bit = 1 << (value - 1);
+
+                values[cell] = value;
+                candidates[cell] = 0;
+                empty--;
+
+                for (uint8_t peer : Tables::PEERS[cell])
+                {
+                        candidates[peer] &= ~bit;
+                }
+        }
+
+        /*
+        Removes candidates from a cell.
+
+        @param cell The cell.
+        @param mask The candidates to remove.
+
+        @return True if a candidate was removed, false otherwise.
+        */
+        bool Grader::eliminate(size_t cell, uint16_t mask) noexcept
+        {
+                if ((candidates[cell] & mask) == 0)
+                {
+                        return false;
+                }
+
+                candidates[cell] &= ~mask;
+
+                return true;
+        }
+// Techniques
+        /*
+        Hidden single: a value with a single place left in a house.
+        */
+        bool Grader::hiddenSingle() noexcept
+        {
+                for (const std::array<uint8_t, 9>& house : Tables::HOUSES)
+                {
+                        uint16_t once = 0;
+                        uint16_t twice = 0;
+
+                        for (uint8_t cell : house)
+                        {
+                                twice |= once & candidates[cell];
+                                once |= candidates[cell];
+                        }
+
+                        uint16_t single = once & ~twice;
+                        if (single == 0)
+                        {
+                                continue;
+                        }
+
+                        int value = lowestValue(single);
+                        for (uint8_t cell : house)
+                        {
+                                if (candidates[cell] & (1 << (value - 1)))
+                                {
+                                        place(cell, value);
+                                        return true;
+                                }
+                        }
+                }
+
+                return false;
+        }
+
+        /*
+        Naked single: a cell with a single candidate left.
+        */
+        bool Grader::nakedSingle() noexcept
+        {
+                for (size_t i = 0; i < 81; i++)
+                {
+                        if (values[i] == 0 && popCount(candidates[i]) == 1)
+                        {
+                                place(i, lowestValue(candidates[i]));
+                                return true;
+                        }
+                }
+
+                return false;
+        }
+
+        /*
+        Pointing: the candidates of a value in a box all lie on one line, so the value is removed
+        from the rest of the line.
+        */
+        bool Grader::pointing() noexcept
+        {
+                for (size_t box = 0; box < 9; box++)
+                {
+                        const std::array<uint8_t, 9>& cells = Tables::HOUSES[18 + box];
+
+                        for (uint16_t bit = 1; bit < 0x200; bit <<= 1)
+                        {
+                                uint16_t rows = 0;
+                                uint16_t cols = 0;
+
+                                for (uint8_t cell : cells)
+                                {
+                                        if (candidates[cell] & bit)
+                                        {
+                                                rows |= 1 << Tables::ROW[cell];
+                                                cols |= 1 << Tables::COL[cell];
+                                        }
+                                }
+
+                                // Two or more cells on a single line, one cell is a hidden single
+                                size_t line;
+                                if (popCount(rows) == 1)
+                                {
+                                        line = lowestValue(rows) - 1;
+                                }
+                                else if (popCount(cols) == 1)
+                                {
+                                        line = 9 + lowestValue(cols) - 1;
+                                }
+                                else
+                                {
+                                        continue;
+                                }
+
+                                bool progress = false;
+                                for (uint8_t cell : Tables::HOUSES[line])
+                                {
+                                        if (Tables::BOX[cell] != box)
+                                        {
+                                                progress |= eliminate(cell, bit);
+                                        }
+                                }
+
+                                if (progress)
+                                {
+                                        return true;
+                                }
+                        }
+                }
+
+                return false;
+        }
+
+        /*
+        Box/line reduction: the candidates of a value on a line all lie in one box, so the value
+        is removed from the rest of the box.
+        */
+        bool Grader::boxLine() noexcept
+        {
+                for (size_t line = 0; line < 18; line++)
+                {
+                        for (uint16_t bit = 1; bit < 0x200; bit <<= 1)
+                        {
+                                uint16_t boxes = 0;
+
+                                for (uint8_t cell : Tables::HOUSES[line])
+                                {
+                                        if (candidates[cell] & bit)
+                                        {
+                                                boxes |= 1 << Tables::BOX[cell];
+                                        }
+                                }
+
+                                if (popCount(boxes) != 1)
+                                {
+                                        continue;
+                                }
+
+                                bool progress = false;
+                                for (uint8_t cell : Tables::HOUSES[18 + lowestValue(boxes) - 1])
+                                {
+                                        size_t cellLine = line < 9 ? Tables::ROW[cell] : 9 + Tables::COL[cell];
+
+                                        if (cellLine != line)
+                                        {
+                                                progress |= eliminate(cell, bit);
+                                        }
+                                }
+
+                                if (progress)
+                                {
+                                        return true;
+                                }
+                        }
+                }
+
+                return false;
+        }
+
+        /*
+        Naked subset: size cells of a house with only size candidates between them, so those
+        values are removed from the other cells of the house.
+
+        @param size The size of the subset, 2 (pair) or 3 (triple).
+        */
+        bool Grader::nakedSubset(int size) noexcept
+        {
+                for (const std::array<uint8_t, 9>& house : Tables::HOUSES)
+                {
+                        std::array<uint16_t, 9> masks;
+
+                        for (size_t j = 0; j < 9; j++)
+                        {
+                                masks[j] = candidates[house[j]];
+                        }
+
+                        bool progress = findSubset(masks, size, [&](uint16_t chosen, uint16_t members)
+                        {
+                                bool eliminated = false;
+
+                                for (size_t j = 0; j < 9; j++)
+                                {
+                                        if (!(chosen & (1 << j)))
+                                        {
+                                                eliminated |= eliminate(house[j], members);
+                                        }
+                                }
+
+                                return eliminated;
+                        });
+
+                        if (progress)
+                        {
+                                return true;
+                        }
+                }
+
+                return false;
+        }
+
+        /*
+        Hidden subset: size values with only size places between them in a house, so the other
+        candidates are removed from those cells.
+
+        @param size The size of the subset, 2 (pair) or 3 (triple).
+        */
+        bool Grader::hiddenSubset(int size) noexcept
+        {
+                for (const std::array<uint8_t, 9>& house : Tables::HOUSES)
+                {
+                        std::array<uint16_t, 9> masks{};
+
+                        for (size_t j = 0; j < 9; j++)
+                        {
+                                for (uint16_t bits = candidates[house[j]]; bits != 0; bits &= bits - 1)
+                                {
+                                        masks[lowestValue(bits) - 1] |= 1 << j;
+                                }
+                        }
+
+                        bool progress = findSubset(masks, size, [&](uint16_t chosen, uint16_t places)
+                        {
+                                bool eliminated = false;
+
+                                for (uint16_t bits = places; bits != 0; bits &= bits - 1)
+                                {
+                                        eliminated |= eliminate(house[lowestValue(bits) - 1], ALL_CANDIDATES & ~chosen);
+                                }
+
+                                return eliminated;
+                        });
+
+                        if (progress)
+                        {
+                                return true;
+                        }
+                }
+
+                return false;
+        }
+
+        /*
+        Fish (X-Wing, Swordfish): the candidates of a value on size rows lie in only size columns,
+        so the value is removed from the rest of those columns. The same holds with the rows and
+        the columns swapped.
+
+        @param size The number of lines, 2 (X-Wing) or 3 (Swordfish).
+        */
+        bool Grader::fish(int size) noexcept
+        {
+                for (uint16_t bit = 1; bit < 0x200; bit <<= 1)
+                {
+                        // base 0 uses the rows as base lines, base 9 the columns
+                        for (size_t base : {0, 9})
+                        {
+                                size_t cover = 9 - base;
+                                std::array<uint16_t, 9> masks{};
+
+                                for (size_t line = 0; line < 9; line++)
+                                {
+                                        const std::array<uint8_t, 9>& cells = Tables::HOUSES[base + line];
+
+                                        for (size_t j = 0; j < 9; j++)
+                                        {
+                                                if (candidates[cells[j]] & bit)
+                                                {
+                                                        masks[line] |= 1 << j;
+                                                }
+                                        }
+                                }
+
+                                bool progress = findSubset(masks, size, [&](uint16_t lines, uint16_t positions)
+                                {
+                                        bool eliminated = false;
+
+                                        for (uint16_t bits = positions; bits != 0; bits &= bits - 1)
+                                        {
+                                                const std::array<uint8_t, 9>& cells = Tables::HOUSES[cover + lowestValue(bits) - 1];
+
+                                                for (size_t j = 0; j < 9; j++)
+                                                {
+                                                        if (!(lines & (1 << j)))
+                                                        {
+                                                                eliminated |= eliminate(cells[j], bit);
+                                                        }
+                                                }
+                                        }
+
+                                        return eliminated;
+                                });
+
+                                if (progress)
+                                {
+                                        return true;
+                                }
+                        }
+                }
+
+                return false;
+        }
+
+        /*
+        XY-Wing: a cell with candidates {a, b} sees a cell with {a, c} and a cell with {b, c}.
+        Either way one of the two holds c, so c is removed from the cells which see both.
+        */
+        bool Grader::xyWing() noexcept
+        {
+                for (size_t pivot = 0; pivot < 81; pivot++)
+                {
+                        uint16_t pivotMask = candidates[pivot];
+                        if (popCount(pivotMask) != 2)
+                        {
+                                continue;
+                        }
+
+                        for (uint8_t first : Tables::PEERS[pivot])
+                        {
+                                uint16_t firstMask = candidates[first];
+                                if (popCount(firstMask) != 2 || popCount(firstMask & pivotMask) != 1)
+                                {
+                                        continue;
+                                }
+
+                                // The second pincer holds the other value of the pivot and c
+                                uint16_t secondMask = pivotMask ^ firstMask;
+                                uint16_t c = firstMask & ~pivotMask;
+
+                                for (uint8_t second : Tables::PEERS[pivot])
+                                {
+                                        if (candidates[second] != secondMask)
+                                        {
+                                                continue;
+                                        }
+
+                                        bool progress = false;
+                                        for (uint8_t cell : Tables::PEERS[first])
+                                        {
+                                                if (cell != second && isPeer(cell, second))
+                                                {
+                                                        progress |= eliminate(cell, c);
+                                                }
+                                        }
+
+                                        if (progress)
+                                        {
+                                                return true;
+                                        }
+                                }
+                        }
+                }
+
+                return false;
+        }
+
+        /*
+        X-Chain: on a single value, a chain of cells alternating between strong links (the only
+        two places of the value in a house) and weak links (two places which see each other),
+        starting and ending with a strong link. If the first cell does not hold the value the
+        last one does, so the value is removed from the cells which see both ends. Skyscrapers,
+        kites and turbot fish are the shortest X-Chains.
+        */
+        bool Grader::xChain() noexcept
+        {
+                for (uint16_t bit = 1; bit < 0x200; bit <<= 1)
+                {
+                        // A cell is in at most three houses, so it has at most three strong links
+                        std::array<std::array<int8_t, 3>, 81> strong;
+                        for (std::array<int8_t, 3>& links : strong)
+                        {
+                                links.fill(-1);
+                        }
+
+                        for (size_t house = 0; house < Tables::HOUSES.size(); house++)
+                        {
+                                std::array<uint8_t, 9> places;
+                                size_t count = 0;
+
+                                for (uint8_t cell : Tables::HOUSES[house])
+                                {
+                                        if ((candidates[cell] & bit) && count < 3)
+                                        {
+                                                places[count++] = cell;
+                                        }
+                                }
+
+                                if (count == 2)
+                                {
+                                        strong[places[0]][house / 9] = places[1];
+                                        strong[places[1]][house / 9] = places[0];
+                                }
+                        }
+
+                        for (size_t start = 0; start < 81; start++)
+                        {
+                                if (!(candidates[start] & bit))
+                                {
+                                        continue;
+                                }
+
+                                // Breadth first over the cells which are on, or off, if start is off
+                                std::array<bool, 81> on{};
+                                std::array<bool, 81> off{};
+                                std::array<std::pair<uint8_t, bool>, 162> queue;
+                                size_t head = 0;
+                                size_t tail = 0;
+                                off[start] = true;
+                                queue[tail++] = {static_cast<uint8_t>(start), false};
+
+                                while (head < tail)
+                                {
+                                        auto [cell, isOn] = queue[head++];
+
+                                        if (!isOn)
+                                        {
+                                                for (int8_t partner : strong[cell])
+                                                {
+                                                        if (partner >= 0 && !on[partner])
+                                                        {
+                                                                on[partner] = true;
+                                                                queue[tail++] = {static_cast<uint8_t>(partner), true};
+                                                        }
+                                                }
+                                                continue;
+                                        }
+
+                                        // Either start or this cell holds the value
+                                        bool progress = false;
+                                        for (uint8_t peer : Tables::PEERS[start])
+                                        {
+                                                if (peer != cell && isPeer(peer, cell))
+                                                {
+                                                        progress |= eliminate(peer, bit);
+                                                }
+                                        }
+
+                                        if (progress)
+                                        {
+                                                return true;
+                                        }
+
+                                        for (uint8_t peer : Tables::PEERS[cell])
+                                        {
+                                                if ((candidates[peer] & bit) && !off[peer])
+                                                {
+                                                        off[peer] = true;
+                                                        queue[tail++] = {peer, false};
+                                                }
+                                        }
+                                }
+                        }
+                }
+
+                return false;
+        }
+
+        /*
+        XY-Chain: a chain of cells with two candidates, each seeing the next and sharing a value
+        with it. If the first cell does not hold its value z, every cell of the chain is forced
+        in turn, and a chain whose last cell is then forced to z means one of the two ends holds
+        z. So z is removed from the cells which see both ends. The XY-Wing is the shortest
+        XY-Chain.
+        */
+        bool Grader::xyChain() noexcept
+        {
+                for (size_t start = 0; start < 81; start++)
+                {
+                        if (popCount(candidates[start]) != 2)
+                        {
+                                continue;
+                        }
+
+                        uint16_t low = candidates[start] & -candidates[start];
+                        for (uint16_t z : {low, static_cast<uint16_t>(candidates[start] ^ low)})
+                        {
+                                // Breadth first over the cells and the values they are forced to
+                                std::array<uint16_t, 81> forced{};
+                                std::array<std::pair<uint8_t, uint16_t>, 162> queue;
+                                size_t head = 0;
+                                size_t tail = 0;
+                                forced[start] = candidates[start] & ~z;
+                                queue[tail++] = {static_cast<uint8_t>(start), forced[start]};
+
+                                while (head < tail)
+                                {
+                                        auto [cell, value] = queue[head++];
+
+                                        for (uint8_t next : Tables::PEERS[cell])
+                                        {
+                                                uint16_t mask = candidates[next];
+                                                if (popCount(mask) != 2 || !(mask & value))
+                                                {
+                                                        continue;
+                                                }
+
+                                                // next can not hold value, so it holds the other one
+                                                uint16_t other = mask & ~value;
+
+                                                if (other == z && next != start)
+                                                {
+                                                        bool progress = false;
+                                                        for (uint8_t peer : Tables::PEERS[start])
+                                                        {
+                                                                if (peer != next && isPeer(peer, next))
+                                                                {
+                                                                        progress |= eliminate(peer, z);
+                                                                }
+                                                        }
+
+                                                        if (progress)
+                                                        {
+                                                                return true;
+                                                        }
+                                                }
+
+                                                if (!(forced[next] & other))
+                                                {
+                                                        forced[next] |= other;
+                                                        queue[tail++] = {next, other};
+                                                }
+                                        }
+                                }
+                        }
+                }
+
+                return false;
+        }
+} // namespace Sudoku
@@ -4,13 +4,15 @@ Date: 09/11/2024
 This file implements the Grid class.
 */
 
+#define LOG_SUBSYSTEM GRID
+
 #include "macros.hpp"
 #include "grid.hpp"
 #include <algorithm>
 #include <array>
 #include <iostream>
-#include <random>
 #include <stdexcept>
+#include <vector>
 
 namespace Sudoku
 {
@@ -52,7 +54,7 @@ namespace Sudoku
                         throw std::out_of_range("Index out of range");
                 }
 
-                return grid[i];
+                return read(i);
         }
 
         /*
@@ -75,7 +77,7 @@ namespace Sudoku
                         throw std::out_of_range("Index out of range");
                 }
 
-                return grid[convertIndex(row, col)];
+                return read(convertIndex(row, col));
         }
 
         /*
@@ -98,7 +100,7 @@ namespace Sudoku
 
                 for (int i = 0; i < 9; i++)
                 {
-                        rowArray[i] = grid[convertIndex(row, i)];
+                        rowArray[i] = read(row * 9 + i);
                 }
         }
 
@@ -122,7 +124,7 @@ namespace Sudoku
 
                 for (size_t i = 0; i < 9; i++)
                 {
-                        colArray[i] = grid[convertIndex(i, col)];
+                        colArray[i] = read(i * 9 + col);
                 }
         }
 
@@ -151,7 +153,7 @@ namespace Sudoku
                         for (size_t j = 0; j < 3; ++j)
                         {
                                 boxArray[i * 3 + j]
-                                        = grid[rowStartIndex + j];
+                                        = read(rowStartIndex + j);
                         }
                         rowStartIndex += 9;
                 }
@@ -169,13 +171,29 @@ namespace Sudoku
         {
                 LOG_TRACE("Grid::setZero() called");
 
+                // Seeded once per thread instead of once per call
+                thread_local Random random;
+                setZero(count, random);
+        }
+
+        /*
+        Sets count random cells to zero using the given random number generator. The same
+        generator state always empties the same cells.
+
+        @param count The number of cells to set to zero.
+        @param random The random number generator.
+        */
+        void Grid::setZero(size_t count, Random& random)
+        {
+                LOG_TRACE("Grid::setZero(Random&) called");
+
                 // First, we find all non-zero cells by index
                 std::vector<size_t> nonZeroCells;
                 nonZeroCells.reserve(size());
 
                 for (size_t i = 0; i < size(); ++i)
                 {
-                        if (grid[i] != 0)
+                        if (read(i) != 0)
                         {
                                 nonZeroCells.push_back(i);
                         }
@@ -183,16 +201,15 @@ namespace Sudoku
 
                 if (count >= nonZeroCells.size())
                 {
-                        grid.fill(0);
+                        clear();
                 }
                 else
                 {
-                        std::shuffle(nonZeroCells.begin(), nonZeroCells.end(),
-                                std::mt19937{std::random_device{}()});
+                        random.shuffle(nonZeroCells.begin(), nonZeroCells.end());
 
                         for (size_t i = 0; i < count; i++)
                         {
-                                grid[nonZeroCells[i]] = 0;
+                                writeExact(nonZeroCells[i], 0);
                         }
                 }
         }
@@ -201,9 +218,10 @@ namespace Sudoku
         Sets the value of the cell at index i.
 
         @param i The index of the cell. Must be in the range [0, 80].
-        @param value The value to set the cell to.
+        @param value The value to set the cell to. Must be in the range [0, 9].
 
         @throw std::out_of_range if i is not in the index range.
+        @throw std::invalid_argument if value is not in the value range.
         */
         void Grid::setCell(size_t i, int value)
         {
@@ -215,16 +233,23 @@ namespace Sudoku
                         throw std::out_of_range("Index out of range");
                 }
 
-                grid[i] = value;
+                if (!checkValue(value))
+                {
+                        LOG_ERROR("Value out of range");
+                        throw std::invalid_argument("Value out of range");
+                }
+
+                writeExact(i, value);
         }
 
         /*
         Sets the row at index row.
 
         @param row The row to set. Must be in the range [0, 8].
-        @param rowArray The array to set the row to.
+        @param rowArray The array to set the row to. Values must be in the range [0, 9].
 
         @throw std::out_of_range if row is not in the index range.
+        @throw std::invalid_argument if any value is not in the value range.
         */
         void Grid::setRow(size_t row, const std::array<int, 9>& rowArray)
         {
@@ -236,9 +261,15 @@ namespace Sudoku
                         throw std::out_of_range("Index out of range");
                 }
 
+                if (!checkValues(rowArray))
+                {
+                        LOG_ERROR("Value out of range");
+                        throw std::invalid_argument("Value out of range");
+                }
+
                 for (size_t i = 0; i < 9; i++)
                 {
-                        grid[convertIndex(row, i)] = rowArray[i];
+                        writeExact(row * 9 + i, rowArray[i]);
                 }
         }
 
@@ -246,9 +277,10 @@ namespace Sudoku
         Sets the column at index col.
 
         @param col The column to set. Must be in the range [0, 8].
-        @param colArray The array to set the column to.
+        @param colArray The array to set the column to. Values must be in the range [0, 9].
 
         @throw std::out_of_range if col is not in the index range.
+        @throw std::invalid_argument if any value is not in the value range.
         */
         void Grid::setCol(size_t col, const std::array<int, 9>& colArray)
         {
@@ -260,9 +292,15 @@ namespace Sudoku
                         throw std::out_of_range("Index out of range");
                 }
 
+                if (!checkValues(colArray))
+                {
+                        LOG_ERROR("Value out of range");
+                        throw std::invalid_argument("Value out of range");
+                }
+
                 for (size_t i = 0; i < 9; i++)
                 {
-                        grid[convertIndex(i, col)] = colArray[i];
+                        writeExact(i * 9 + col, colArray[i]);
                 }
         }
 
@@ -270,9 +308,10 @@ namespace Sudoku
         Sets the box at index box.
 
         @param box The box to set. Must be in the range [0, 8].
-        @param boxArray The array to set the box to.
+        @param boxArray The array to set the box to. Values must be in the range [0, 9].
 
         @throw std::out_of_range if box is not in the index range.
+        @throw std::invalid_argument if any value is not in the value range.
         */
         void Grid::setBox(size_t box, const std::array<int, 9>& boxArray)
         {
@@ -284,13 +323,19 @@ namespace Sudoku
                         throw std::out_of_range("Index out of range");
                 }
 
+                if (!checkValues(boxArray))
+                {
+                        LOG_ERROR("Value out of range");
+                        throw std::invalid_argument("Value out of range");
+                }
+
                 size_t rowStartIndex = (box / 3) * 27 + (box % 3) * 3;
 
                 for (size_t i = 0; i < 3; ++i)
                 {
                         for (size_t j = 0; j < 3; ++j)
                         {
-                                grid[rowStartIndex + j] = boxArray[i * 3 + j];
+                                writeExact(rowStartIndex + j, boxArray[i * 3 + j]);
                         }
                         rowStartIndex += 9;
                 }
@@ -310,24 +355,43 @@ namespace Sudoku
 
         /*
         Clears the grid.
+
+        @note Clears the fixed flags.
         */
         void Grid::clear() noexcept
         {
                 LOG_TRACE("Grid::clear() called");
 
                 grid.fill(0);
+                rowMasks.fill(0);
+                colMasks.fill(0);
+                boxMasks.fill(0);
+                #ifdef GRID_HASH
+                zobrist = 0;
+                #endif
         }
 
         /*
         Fills the grid with a value.
 
-        @param value The value to fill the grid with. Default is 0.
+        @param value The value to fill the grid with. Must be in the range [0, 9]. Default is 0.
+
+        @throw std::invalid_argument if value is not in the value range.
+
+        @note Clears the fixed flags.
         */
         void Grid::fill(int value)
         {
                 LOG_TRACE("Grid::fill() called");
 
-                grid.fill(value);
+                if (!checkValue(value))
+                {
+                        LOG_ERROR("Value out of range");
+                        throw std::invalid_argument("Value out of range");
+                }
+
+                grid.fill(static_cast<uint8_t>(value));
+                rebuildMasks();
         }
 
         /*
@@ -363,7 +427,7 @@ namespace Sudoku
                 {
                         for (int j = 0; j < 9; j++)
                         {
-                                std::cout << grid[Grid::convertIndex(i, j)] << " ";
+                                std::cout << read(Grid::convertIndex(i, j)) << " ";
                                 if (j == 2 || j == 5)
                                 {
                                         std::cout << "| ";
@@ -388,7 +452,14 @@ namespace Sudoku
         {
                 LOG_TRACE("Grid::count() called");
 
-                return std::count(grid.begin(), grid.end(), value);
+                int count = 0;
+
+                for (size_t i = 0; i < grid.size(); i++)
+                {
+                        count += read(i) == value;
+                }
+
+                return count;
         }
 // Checkers
         /*
@@ -403,31 +474,43 @@ namespace Sudoku
         {
                 LOG_TRACE("Grid::isSolved() called");
 
-                if (contains(0))
-                {
-                        return false;
-                }
+                return !contains(0) && isValid();
+        }
 
-                for (size_t i = 0; i < 9; i++)
+        /*
+        Checks if the grid is valid.
+
+        @return True if the grid is valid, false otherwise.
+
+        @note A grid is considered valid if no value in the range [1, 9] occurs twice in any
+                row, column, or box. Zeros are allowed.
+        */
+        bool Grid::isValid() const noexcept
+        {
+                LOG_TRACE("Grid::isValid() called");
+
+                // Walks the cells directly, the solver checks every grid it starts on
+                for (const std::array<uint8_t, 9>& house : Tables::HOUSES)
                 {
-                        std::array<int, 9> arr;
+                        uint16_t seen = 0;
 
-                        getRow(i, arr);
-                        if (!areValidValues(arr))
+                        for (uint8_t cell : house)
                         {
-                                return false;
-                        }
+                                int value = read(cell);
 
-                        getCol(i, arr);
-                        if (!areValidValues(arr))
-                        {
-                                return false;
-                        }
+                                if (value == 0)
+                                {
+                                        continue;
+                                }
 
-                        getBox(i, arr);
-                        if (!areValidValues(arr))
-                        {
-                                return false;
+                                uint16_t bit = 1 << (value - 1);
+
+                                if (seen & bit)
+                                {
+                                        return false;
+                                }
+
+                                seen |= bit;
                         }
                 }
 
@@ -445,7 +528,15 @@ namespace Sudoku
         {
                 LOG_TRACE("Grid::contains() called");
 
-                return std::find(grid.begin(), grid.end(), value) != grid.end();
+                for (size_t i = 0; i < grid.size(); i++)
+                {
+                        if (read(i) == value)
+                        {
+                                return true;
+                        }
+                }
+
+                return false;
         }
 
         /*
@@ -496,35 +587,179 @@ namespace Sudoku
         @throw std::out_of_range if i is not in the index range.
 
         @note A value can be set if placing it would not violate the rules of sudoku.
+                Setting zero is always valid and values outside [0, 9] never are.
         */
-        bool Grid::isValidValueToSet(size_t i, int value)
+        bool Grid::isValidValueToSet(size_t i, int value) const
         {
                 LOG_TRACE("Grid::isValidValueToSet() called");
 
-                // We place the value at the index and check if the grid is still valid
-                int originalValue = grid[i];
-                setCell(i, value);
+                // Also checks the index
+                uint16_t mask = candidates(i);
+
+                if (value == 0)
+                {
+                        return true;
+                }
+
+                if (value < 1 || value > 9)
+                {
+                        return false;
+                }
+
+                return mask & (1 << (value - 1));
+        }
+// Candidates
+        /*
+        Returns the values which can be placed into the cell at index i.
+
+        @param i The index of the cell. Must be in the range [0, 80].
+
+        @return Bitmask where bit (value - 1) is set if value can be placed into the cell.
+
+        @throw std::out_of_range if i is not in the index range.
+
+        @note The current value of the cell is ignored, so a filled cell reports its own value as
+                a candidate, unless a peer holds the same value.
+        */
+        uint16_t Grid::candidates(size_t i) const
+        {
+                LOG_TRACE("Grid::candidates() called");
 
-                // Check if the grid is still valid
-                size_t row = i / 9;
-                size_t col = i % 9;
-                std::array<int, 9> arr;
-                bool valid = true;
+                if (!checkCellIndex(i))
+                {
+                        LOG_ERROR("Index out of range");
+                        throw std::out_of_range("Index out of range");
+                }
 
-                getRow(row, arr);
-                valid = areValidValues(arr);
+                return candidatesUnchecked(i);
+        }
 
-                getCol(col, arr);
-                valid = valid && areValidValues(arr);
+        /*
+        Returns the number of values which can be placed into the cell at index i.
 
-                size_t box = (row / 3) * 3 + (col / 3);
-                getBox(box, arr);
-                valid = valid && areValidValues(arr);
+        @param i The index of the cell. Must be in the range [0, 80].
 
-                // Reset the cell to its original value
-                setCell(i, originalValue);
+        @return The number of candidates of the cell.
 
-                return valid;
+        @throw std::out_of_range if i is not in the index range.
+        */
+        int Grid::candidateCount(size_t i) const
+        {
+                LOG_TRACE("Grid::candidateCount() called");
+
+                return popCount(candidates(i));
+        }
+// Fixed cells
+        /*
+        Checks if the cell at index i is fixed.
+
+        @param i The index of the cell. Must be in the range [0, 80].
+
+        @return True if the cell is fixed, false otherwise.
+
+        @throw std::out_of_range if i is not in the index range.
+        */
+        bool Grid::isFixed(size_t i) const
+        {
+                LOG_TRACE("Grid::isFixed() called");
+
+                if (!checkCellIndex(i))
+                {
+                        LOG_ERROR("Index out of range");
+                        throw std::out_of_range("Index out of range");
+                }
+
+                return grid[i] & FIXED_BIT;
+        }
+
+        /*
+        Marks the cell at index i as fixed or not fixed.
+
+        @param i The index of the cell. Must be in the range [0, 80].
+        @param fixed True if the cell should be fixed, false otherwise.
+
+        @throw std::out_of_range if i is not in the index range.
+        */
+        void Grid::setFixed(size_t i, bool fixed)
+        {
+                LOG_TRACE("Grid::setFixed() called");
+
+                if (!checkCellIndex(i))
+                {
+                        LOG_ERROR("Index out of range");
+                        throw std::out_of_range("Index out of range");
+                }
+
+                grid[i] = fixed ? grid[i] | FIXED_BIT : grid[i] & ~FIXED_BIT;
+        }
+
+        /*
+        Marks the filled cells as fixed and the empty cells as not fixed, which turns a freshly
+        generated puzzle into a game.
+        */
+        void Grid::fixGivens() noexcept
+        {
+                LOG_TRACE("Grid::fixGivens() called");
+
+                for (uint8_t& cell : grid)
+                {
+                        cell = (cell & VALUE_BITS) != 0 ? cell | FIXED_BIT : cell & ~FIXED_BIT;
+                }
+        }
+// Packing
+        /*
+        Packs the grid into its compact form.
+
+        @param packed The packed grid to store the cells in.
+        */
+        void Grid::pack(PackedGrid& packed) const noexcept
+        {
+                LOG_TRACE("Grid::pack() called");
+
+                packed.cells.fill(0);
+                packed.fixed.fill(0);
+
+                for (size_t i = 0; i < grid.size(); i++)
+                {
+                        packed.cells[i / 2] |= read(i) << ((i % 2) * 4);
+
+                        if (grid[i] & FIXED_BIT)
+                        {
+                                packed.fixed[i / 8] |= 1 << (i % 8);
+                        }
+                }
+        }
+
+        /*
+        Unpacks the grid from its compact form.
+
+        @param packed The packed grid to read the cells from.
+
+        @throw std::invalid_argument if a packed value is not in the value range.
+        */
+        void Grid::unpack(const PackedGrid& packed)
+        {
+                LOG_TRACE("Grid::unpack() called");
+
+                for (size_t i = 0; i < grid.size(); i++)
+                {
+                        int value = (packed.cells[i / 2] >> ((i % 2) * 4)) & VALUE_BITS;
+
+                        if (!checkValue(value))
+                        {
+                                LOG_ERROR("Value out of range");
+                                throw std::invalid_argument("Value out of range");
+                        }
+
+                        grid[i] = value;
+
+                        if (packed.fixed[i / 8] & (1 << (i % 8)))
+                        {
+                                grid[i] |= FIXED_BIT;
+                        }
+                }
+
+                rebuildMasks();
         }
 
 // Utility checkers
@@ -577,4 +812,85 @@ namespace Sudoku
                 return i < 9;
         }
 
+        /*
+        Checks if the value can be stored in a cell.
+
+        @param value The value to check.
+
+        @return True if the value is valid, false otherwise.
+
+        @note The value is considered valid if it is in the range [0, 9].
+        */
+        bool Grid::checkValue(int value) const noexcept
+        {
+                LOG_TRACE("Grid::checkValue() called");
+
+                return value >= 0 && value <= 9;
+        }
+
+        /*
+        Checks if all the values of an array can be stored in cells.
+
+        @param array The array of values to check.
+
+        @return True if all the values are valid, false otherwise.
+        */
+        bool Grid::checkValues(const std::array<int, 9>& array) const noexcept
+        {
+                LOG_TRACE("Grid::checkValues() called");
+
+                return std::all_of(array.begin(), array.end(),
+                        [this](int value) { return checkValue(value); });
+        }
+// Cells
+        /*
+        Writes a value into the cell at index i like write() but keeps the masks exact even if
+        the old value still occurs elsewhere in one of the houses of the cell.
+
+        @param i The index of the cell. Must be in the range [0, 80].
+        @param value The value to write. Must be in the range [0, 9].
+
+        @note Used by the checked setters which may be given grids with duplicates.
+        */
+        void Grid::writeExact(size_t i, int value) noexcept
+        {
+                int oldValue = read(i);
+
+                write(i, value);
+
+                if (oldValue == 0 || oldValue == value)
+                {
+                        return;
+                }
+
+                for (uint8_t peer : Tables::PEERS[i])
+                {
+                        if (read(peer) == oldValue)
+                        {
+                                updateMasks(peer, 0, oldValue);
+                        }
+                }
+        }
+// Masks
+        /*
+        Recomputes all the masks and the hash from the cells.
+        */
+        void Grid::rebuildMasks() noexcept
+        {
+                rowMasks.fill(0);
+                colMasks.fill(0);
+                boxMasks.fill(0);
+                #ifdef GRID_HASH
+                zobrist = 0;
+                #endif
+
+                for (size_t i = 0; i < grid.size(); i++)
+                {
+                        updateMasks(i, 0, read(i));
+                        #ifdef GRID_HASH
+                        zobrist ^= Tables::ZOBRIST[i][read(i)];
+                        #endif
+                }
+        }
+
 } // namespace Sudoku
\ No newline at end of file
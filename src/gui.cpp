@@ -4,9 +4,12 @@ Date: 10/11/2024
 GUI class controls the graphical user interface of the program.
 */
 
+#define LOG_SUBSYSTEM GUI
+
 #include "macros.hpp"
 #include "gui.hpp"
 #include "scenes.hpp"
+#include "tracer.hpp"
 #include <algorithm>
 #include <chrono>
 #include <memory>
@@ -207,6 +210,7 @@ namespace System
         void GUI::render()
         {
                 LOG_TRACE("GUI::render() called");
+                TRACE_SCOPE("GUI::render");
 
                 window.clear();
 
@@ -229,6 +233,7 @@ namespace System
         void GUI::handleEvent(const sf::Event& event)
         {
                 LOG_TRACE("GUI::handleEvent() called");
+                TRACE_SCOPE("GUI::handleEvent");
 
                 // Click event
                 if (event.type == sf::Event::MouseButtonPressed)
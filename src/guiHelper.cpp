@@ -4,6 +4,8 @@ Date: 15/11/2024
 This file contains helper functions for the GUI.
 */
 
+#define LOG_SUBSYSTEM GUI
+
 #include "grid.hpp"
 #include "gui.hpp"
 #include "guiHelper.hpp"
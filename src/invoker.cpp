@@ -4,6 +4,8 @@ Date: 13/11/2024
 Invoker class is used to execute commands. Following the command pattern.
 */
 
+#define LOG_SUBSYSTEM GUI
+
 #include "command.hpp"
 #include "invoker.hpp"
 #include "macros.hpp"
@@ -4,6 +4,8 @@ Date: 23/11/2024
 Music class manages the music in the application.
 */
 
+#define LOG_SUBSYSTEM GUI
+
 #include "macros.hpp"
 #include "music.hpp"
 #include <memory>
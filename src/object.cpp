@@ -4,6 +4,8 @@ Date: 11/11/2024
 Object class stores the properties of an object in the scene.
 */
 
+#define LOG_SUBSYSTEM GUI
+
 #include "macros.hpp"
 #include "object.hpp"
 #include <filesystem>
@@ -0,0 +1,196 @@
+/*
+Date: 18/10/2026
+
+Pregenerator keeps a few puzzles of every difficulty ready on a background thread.
+*/
+
+#define LOG_SUBSYSTEM GENERATOR
+
+#include "difficulty.hpp"
+#include "generatorPool.hpp"
+#include "macros.hpp"
+#include "pregenerator.hpp"
+#include "random.hpp"
+#include "tracer.hpp"
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace Sudoku
+{
+// Class methods
+        /*
+        Constructor for the Pregenerator class. Nothing is generated until start() is called.
+        */
+        Pregenerator::Pregenerator()
+        {
+                LOG_TRACE("Pregenerator::Pregenerator() called");
+        }
+
+        /*
+        Destructor for the Pregenerator class. Stops the producer thread.
+        */
+        Pregenerator::~Pregenerator()
+        {
+                LOG_TRACE("Pregenerator::~Pregenerator() called");
+
+                stop();
+        }
+// Pregenerator methods
+        /*
+        Starts the producer thread. Does nothing if it is already running.
+
+        @param levels The difficulties to generate, one flag per LEVELS entry.
+        */
+        void Pregenerator::start(const std::array<bool, 4>& levels)
+        {
+                LOG_TRACE("Pregenerator::start() called");
+
+                if (producer.joinable())
+                {
+                        return;
+                }
+
+                enabled = levels;
+                running = true;
+                producer = std::thread(&Pregenerator::run, this);
+        }
+
+        /*
+        Stops the producer thread and waits for it, at most until the puzzle being generated is
+        done. The puzzles already generated can still be popped.
+        */
+        void Pregenerator::stop() noexcept
+        {
+                LOG_TRACE("Pregenerator::stop() called");
+
+                if (!producer.joinable())
+                {
+                        return;
+                }
+
+                {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        running = false;
+                }
+                wakeUp.notify_all();
+
+                producer.join();
+        }
+
+        /*
+        Takes a ready puzzle. Must only be called by one thread, the game thread.
+
+        @param difficulty The difficulty of the puzzle.
+        @param puzzle The puzzle to store the ready puzzle in.
+
+        @return True if a puzzle was ready, false otherwise.
+        */
+        bool Pregenerator::pop(Difficulty difficulty, GeneratedPuzzle& puzzle)
+        {
+                LOG_TRACE("Pregenerator::pop() called");
+
+                int level = getLevel(difficulty);
+                if (level < 0 || !queues[level].pop(puzzle))
+                {
+                        return false;
+                }
+
+                // Taking the lock once makes sure the producer is either awake or already waiting
+                {
+                        std::lock_guard<std::mutex> lock(mutex);
+                }
+                wakeUp.notify_one();
+
+                return true;
+        }
+// Getters
+        /*
+        Returns the number of ready puzzles of a difficulty.
+
+        @param difficulty The difficulty.
+
+        @return The number of puzzles.
+        */
+        size_t Pregenerator::size(Difficulty difficulty) const noexcept
+        {
+                LOG_TRACE("Pregenerator::size() called");
+
+                int level = getLevel(difficulty);
+
+                return level >= 0 ? queues[level].size() : 0;
+        }
+// Checker
+        /*
+        Checks if the producer thread is running.
+
+        @return True if puzzles are being generated, false otherwise.
+        */
+        bool Pregenerator::isRunning() const noexcept
+        {
+                LOG_TRACE("Pregenerator::isRunning() called");
+
+                return running;
+        }
+// Pregenerator methods
+        /*
+        Body of the producer thread. Tops the queues up one puzzle at a time, round robin over the
+        difficulties, and sleeps while they are all full.
+        */
+        void Pregenerator::run()
+        {
+                LOG_TRACE("Pregenerator::run() called");
+                TRACE_THREAD("pregenerator");
+
+                try
+                {
+                        Random random;
+
+                        while (running)
+                        {
+                                bool generated = false;
+
+                                for (size_t level = 0; level < LEVELS.size() && running; level++)
+                                {
+                                        if (enabled[level] && queues[level].size() < CAPACITY)
+                                        {
+                                                queues[level].push(GeneratorPool::generateOne(LEVELS[level], random()));
+                                                generated = true;
+                                        }
+                                }
+
+                                if (!generated)
+                                {
+                                        std::unique_lock<std::mutex> lock(mutex);
+                                        wakeUp.wait(lock, [this] { return !running || isHungry(); });
+                                }
+                        }
+                }
+                // The games are generated synchronously from now on
+                catch (const std::exception& e)
+                {
+                        LOG_ERROR("Pregenerator stopped: {}", e.what());
+                        running = false;
+                }
+        }
+
+        /*
+        Checks if a queue of a generated difficulty has room for another puzzle.
+
+        @return True if a puzzle should be generated, false otherwise.
+        */
+        bool Pregenerator::isHungry() const noexcept
+        {
+                for (size_t level = 0; level < LEVELS.size(); level++)
+                {
+                        if (enabled[level] && queues[level].size() < CAPACITY)
+                        {
+                                return true;
+                        }
+                }
+
+                return false;
+        }
+} // namespace Sudoku
@@ -0,0 +1,419 @@
+/*
+Date: 18/10/2026
+
+PuzzleBank is a memory mapped file of pregenerated puzzles.
+*/
+
+#define LOG_SUBSYSTEM GENERATOR
+
+#include "difficulty.hpp"
+#include "generatorPool.hpp"
+#include "grader.hpp"
+#include "grid.hpp"
+#include "macros.hpp"
+#include "puzzleBank.hpp"
+#include "random.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // !_WIN32
+
+namespace
+{
+        constexpr std::array<char, 8> MAGIC = {'S', 'D', 'K', 'B', 'A', 'N', 'K', '\0'};
+} // namespace
+
+namespace Sudoku
+{
+// Class methods
+        /*
+        Constructor for the PuzzleBank class. The bank is empty until open() is called.
+        */
+        PuzzleBank::PuzzleBank()
+        {
+                LOG_TRACE("PuzzleBank::PuzzleBank() called");
+        }
+
+        /*
+        Constructor for the PuzzleBank class.
+
+        @param path The path of the bank file.
+
+        @throw std::runtime_error if the file can not be mapped or is not a valid bank.
+        */
+        PuzzleBank::PuzzleBank(const std::string& path)
+        {
+                LOG_TRACE("PuzzleBank::PuzzleBank(std::string) called");
+
+                open(path);
+        }
+
+        /*
+        Destructor for the PuzzleBank class.
+        */
+        PuzzleBank::~PuzzleBank()
+        {
+                LOG_TRACE("PuzzleBank::~PuzzleBank() called");
+
+                close();
+        }
+// Bank methods
+        /*
+        Maps a bank file into memory, the records are read from the mapping on demand. On Windows
+        the file is read into memory instead.
+
+        @param path The path of the bank file.
+
+        @throw std::runtime_error if the file can not be mapped or is not a valid bank.
+        */
+        void PuzzleBank::open(const std::string& path)
+        {
+                LOG_TRACE("PuzzleBank::open() called");
+
+                close();
+
+                #ifdef _WIN32
+                std::ifstream stream(path, std::ios::binary | std::ios::ate);
+                if (!stream)
+                {
+                        LOG_ERROR("Failed to open puzzle bank: {}", path);
+                        throw std::runtime_error("Failed to open puzzle bank: " + path);
+                }
+
+                std::streamoff size = stream.tellg();
+                if (size < static_cast<std::streamoff>(sizeof(BankHeader)))
+                {
+                        LOG_ERROR("Puzzle bank too small: {}", path);
+                        throw std::runtime_error("Invalid puzzle bank: " + path);
+                }
+
+                // Words keep the records as aligned as a mapping would
+                length = static_cast<size_t>(size);
+                contents.resize((length + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+                stream.seekg(0);
+                stream.read(reinterpret_cast<char*>(contents.data()), length);
+
+                if (!stream)
+                {
+                        close();
+                        LOG_ERROR("Failed to read puzzle bank: {}", path);
+                        throw std::runtime_error("Failed to read puzzle bank: " + path);
+                }
+
+                header = reinterpret_cast<const BankHeader*>(contents.data());
+                #else
+                int file = ::open(path.c_str(), O_RDONLY);
+                if (file < 0)
+                {
+                        LOG_ERROR("Failed to open puzzle bank: {}", path);
+                        throw std::runtime_error("Failed to open puzzle bank: " + path);
+                }
+
+                struct stat info;
+                if (fstat(file, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(BankHeader))
+                {
+                        ::close(file);
+                        LOG_ERROR("Puzzle bank too small: {}", path);
+                        throw std::runtime_error("Invalid puzzle bank: " + path);
+                }
+
+                length = info.st_size;
+                mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, file, 0);
+                ::close(file);
+
+                if (mapping == MAP_FAILED)
+                {
+                        mapping = nullptr;
+                        length = 0;
+                        LOG_ERROR("Failed to map puzzle bank: {}", path);
+                        throw std::runtime_error("Failed to map puzzle bank: " + path);
+                }
+
+                // Games pick records at random, reading ahead would only load pages never used
+                madvise(mapping, length, MADV_RANDOM);
+
+                header = static_cast<const BankHeader*>(mapping);
+                #endif // _WIN32
+                records = reinterpret_cast<const BankRecord*>(header + 1);
+
+                bool valid = header->magic == MAGIC && header->version == VERSION
+                        && header->recordSize == sizeof(BankRecord)
+                        && header->count <= (length - sizeof(BankHeader)) / sizeof(BankRecord);
+
+                for (const BankSection& section : header->sections)
+                {
+                        valid = valid && section.first <= header->count
+                                && section.count <= header->count - section.first;
+                }
+
+                if (!valid)
+                {
+                        close();
+                        LOG_ERROR("Invalid puzzle bank: {}", path);
+                        throw std::runtime_error("Invalid puzzle bank: " + path);
+                }
+
+                LOG_INFO("Puzzle bank {} opened with {} puzzles", path, header->count);
+        }
+
+        /*
+        Unmaps the bank file, the records returned before are no longer valid.
+        */
+        void PuzzleBank::close() noexcept
+        {
+                LOG_TRACE("PuzzleBank::close() called");
+
+                #ifdef _WIN32
+                contents.clear();
+                contents.shrink_to_fit();
+                #else
+                if (mapping != nullptr)
+                {
+                        munmap(mapping, length);
+                }
+                #endif // _WIN32
+
+                mapping = nullptr;
+                length = 0;
+                header = nullptr;
+                records = nullptr;
+        }
+
+        /*
+        Picks a random puzzle of a difficulty.
+
+        @param difficulty The difficulty of the puzzle.
+        @param random The random number generator.
+
+        @return The record of the puzzle, nullptr if the bank has no puzzle of that difficulty or
+                the picked record is corrupt.
+        */
+        const BankRecord* PuzzleBank::pick(Difficulty difficulty, Random& random) const
+        {
+                LOG_TRACE("PuzzleBank::pick() called");
+
+                int section = getSection(difficulty);
+                if (header == nullptr || section < 0 || header->sections[section].count == 0)
+                {
+                        return nullptr;
+                }
+
+                const BankSection& range = header->sections[section];
+                const BankRecord* record = &records[range.first + random.below(range.count)];
+
+                if (!isValidRecord(*record))
+                {
+                        LOG_WARN("Corrupt puzzle bank record {} skipped", record - records);
+                        return nullptr;
+                }
+
+                return record;
+        }
+
+        /*
+        Generates and grades puzzles in parallel and writes them to a bank file. The puzzles are
+        generated and written in chunks, so the size of the bank is not limited by memory.
+
+        @param path The path of the bank file, overwritten.
+        @param counts The number of puzzles of every section (EASY, MEDIUM, HARD, EXPERT).
+        @param masterSeed The seed all the puzzle seeds are derived from.
+        @param threads The number of threads, 0 uses one per hardware thread.
+
+        @throw std::runtime_error if the file can not be written.
+        */
+        void PuzzleBank::build(const std::string& path, const std::array<size_t, 4>& counts,
+                uint64_t masterSeed, size_t threads)
+        {
+                LOG_TRACE("PuzzleBank::build() called");
+
+                std::ofstream file(path, std::ios::binary | std::ios::trunc);
+                if (!file)
+                {
+                        LOG_ERROR("Failed to create puzzle bank: {}", path);
+                        throw std::runtime_error("Failed to create puzzle bank: " + path);
+                }
+
+                BankHeader bankHeader{};
+                bankHeader.magic = MAGIC;
+                bankHeader.version = VERSION;
+                bankHeader.recordSize = sizeof(BankRecord);
+
+                // Written again once the sections are known
+                file.write(reinterpret_cast<const char*>(&bankHeader), sizeof(bankHeader));
+
+                GeneratorPool pool(threads);
+                Grader grader;
+                Grid grid;
+                std::vector<BankRecord> chunk;
+
+                for (size_t section = 0; section < LEVELS.size(); section++)
+                {
+                        uint64_t sectionSeed = GeneratorPool::puzzleSeed(masterSeed, section);
+                        bankHeader.sections[section] = {bankHeader.count, counts[section]};
+
+                        for (size_t start = 0; start < counts[section]; start += CHUNK)
+                        {
+                                size_t count = std::min(CHUNK, counts[section] - start);
+                                std::vector<GeneratedPuzzle> puzzles = pool.generate(count, LEVELS[section],
+                                        GeneratorPool::puzzleSeed(sectionSeed, start / CHUNK));
+
+                                chunk.assign(count, BankRecord{});
+                                for (size_t k = 0; k < count; k++)
+                                {
+                                        grid.unpack(puzzles[k].puzzle);
+                                        Grade grade = grader.grade(grid);
+
+                                        chunk[k].puzzle = puzzles[k].puzzle;
+                                        chunk[k].solution = puzzles[k].solution;
+                                        chunk[k].seed = puzzles[k].seed;
+                                        chunk[k].score = std::min(grade.score, static_cast<int>(UINT16_MAX));
+                                        chunk[k].technique = static_cast<uint8_t>(grade.hardest);
+                                        chunk[k].difficulty = static_cast<uint8_t>(LEVELS[section]);
+                                }
+
+                                file.write(reinterpret_cast<const char*>(chunk.data()), count * sizeof(BankRecord));
+                                bankHeader.count += count;
+                        }
+
+                        LOG_DEBUG("PuzzleBank::build() wrote {} puzzles of section {}", counts[section], section);
+                }
+
+                file.seekp(0);
+                file.write(reinterpret_cast<const char*>(&bankHeader), sizeof(bankHeader));
+                file.close();
+
+                if (!file)
+                {
+                        LOG_ERROR("Failed to write puzzle bank: {}", path);
+                        throw std::runtime_error("Failed to write puzzle bank: " + path);
+                }
+        }
+// Getters
+        /*
+        Returns a record of the bank.
+
+        @param index The index of the record.
+
+        @return The record, valid until the bank is closed.
+
+        @throw std::out_of_range if the index is not in the bank.
+        */
+        const BankRecord& PuzzleBank::getRecord(size_t index) const
+        {
+                LOG_TRACE("PuzzleBank::getRecord() called");
+
+                if (index >= size())
+                {
+                        LOG_ERROR("Record index out of range: {}", index);
+                        throw std::out_of_range("Record index out of range");
+                }
+
+                return records[index];
+        }
+
+        /*
+        Returns the number of puzzles in the bank.
+
+        @return The number of puzzles, 0 if no bank is open.
+        */
+        size_t PuzzleBank::size() const noexcept
+        {
+                LOG_TRACE("PuzzleBank::size() called");
+
+                return header != nullptr ? header->count : 0;
+        }
+
+        /*
+        Returns the number of puzzles of a difficulty.
+
+        @param difficulty The difficulty.
+
+        @return The number of puzzles.
+        */
+        size_t PuzzleBank::count(Difficulty difficulty) const noexcept
+        {
+                LOG_TRACE("PuzzleBank::count() called");
+
+                int section = getSection(difficulty);
+
+                return header != nullptr && section >= 0 ? header->sections[section].count : 0;
+        }
+// Checker
+        /*
+        Checks if a bank file is mapped.
+
+        @return True if a bank is open, false otherwise.
+        */
+        bool PuzzleBank::isOpen() const noexcept
+        {
+                LOG_TRACE("PuzzleBank::isOpen() called");
+
+                return header != nullptr;
+        }
+
+        /*
+        Checks if a record holds a playable puzzle: the solution is a solved grid and every given
+        of the puzzle agrees with it.
+
+        @param record The record.
+
+        @return True if the record is valid, false otherwise.
+        */
+        bool PuzzleBank::isValidRecord(const BankRecord& record) noexcept
+        {
+                LOG_TRACE("PuzzleBank::isValidRecord() called");
+
+                Grid puzzle;
+                Grid solution;
+
+                try
+                {
+                        puzzle.unpack(record.puzzle);
+                        solution.unpack(record.solution);
+                }
+                catch (const std::invalid_argument&)
+                {
+                        return false;
+                }
+
+                if (!solution.isSolved())
+                {
+                        return false;
+                }
+
+                for (size_t i = 0; i < puzzle.size(); i++)
+                {
+                        int value = puzzle.getCellUnchecked(i);
+
+                        if (value != 0 && value != solution.getCellUnchecked(i))
+                        {
+                                return false;
+                        }
+                }
+
+                return true;
+        }
+// Utility methods
+        /*
+        Returns the section of the bank holding the puzzles of a difficulty.
+
+        @param difficulty The difficulty.
+
+        @return The section, -1 if the bank has no section for the difficulty.
+        */
+        int PuzzleBank::getSection(Difficulty difficulty) noexcept
+        {
+                return getLevel(difficulty);
+        }
+} // namespace Sudoku
@@ -0,0 +1,134 @@
+/*
+Date: 18/10/2026
+
+PuzzleFormat reads and writes puzzles in the one line format.
+*/
+
+#define LOG_SUBSYSTEM GRID
+
+#include "grid.hpp"
+#include "macros.hpp"
+#include "puzzleFormat.hpp"
+#include <cstddef>
+#include <string>
+
+namespace Sudoku
+{
+// Parsing
+        /*
+        Reads a puzzle from a line.
+
+        @param line The line, at least 81 characters.
+        @param grid The grid to store the puzzle in, cleared first. Givens are not marked fixed.
+
+        @return True if the line holds a puzzle, false otherwise. The grid is undefined on failure.
+
+        @note Givens which break the rules are read as they are, solving such a grid fails.
+        */
+        bool PuzzleFormat::parse(const std::string& line, Grid& grid)
+        {
+                LOG_TRACE("PuzzleFormat::parse() called");
+
+                if (line.size() < 81)
+                {
+                        return false;
+                }
+
+                grid.clear();
+
+                for (size_t i = 0; i < 81; i++)
+                {
+                        char c = line[i];
+
+                        if (c >= '1' && c <= '9')
+                        {
+                                grid.setCell(i, c - '0');
+                        }
+                        else if (c != '0' && c != '.')
+                        {
+                                return false;
+                        }
+                }
+
+                return true;
+        }
+
+        /*
+        Reads a puzzle from a line into its compact form.
+
+        @param line The line, at least 81 characters.
+        @param packed The packed grid to store the puzzle in. No cell is marked fixed.
+
+        @return True if the line holds a puzzle, false otherwise. The grid is undefined on failure.
+        */
+        bool PuzzleFormat::parse(const std::string& line, PackedGrid& packed)
+        {
+                LOG_TRACE("PuzzleFormat::parse(PackedGrid) called");
+
+                if (line.size() < 81)
+                {
+                        return false;
+                }
+
+                packed.cells.fill(0);
+                packed.fixed.fill(0);
+
+                for (size_t i = 0; i < 81; i++)
+                {
+                        char c = line[i];
+
+                        if (c >= '1' && c <= '9')
+                        {
+                                packed.cells[i / 2] |= (c - '0') << ((i % 2) * 4);
+                        }
+                        else if (c != '0' && c != '.')
+                        {
+                                return false;
+                        }
+                }
+
+                return true;
+        }
+// Formatting
+        /*
+        Writes a grid as a line of 81 digits, 0 for the empty cells.
+
+        @param grid The grid.
+
+        @return The line, without a line break.
+        */
+        std::string PuzzleFormat::format(const Grid& grid)
+        {
+                LOG_TRACE("PuzzleFormat::format() called");
+
+                std::string line(81, '0');
+
+                for (size_t i = 0; i < 81; i++)
+                {
+                        line[i] = static_cast<char>('0' + grid.getCellUnchecked(i));
+                }
+
+                return line;
+        }
+
+        /*
+        Writes a packed grid as a line of 81 digits, 0 for the empty cells.
+
+        @param packed The packed grid.
+
+        @return The line, without a line break.
+        */
+        std::string PuzzleFormat::format(const PackedGrid& packed)
+        {
+                LOG_TRACE("PuzzleFormat::format(PackedGrid) called");
+
+                std::string line(81, '0');
+
+                for (size_t i = 0; i < 81; i++)
+                {
+                        line[i] = static_cast<char>('0' + ((packed.cells[i / 2] >> ((i % 2) * 4)) & 0x0F));
+                }
+
+                return line;
+        }
+} // namespace Sudoku
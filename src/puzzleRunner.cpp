@@ -0,0 +1,246 @@
+/*
+Date: 18/10/2026
+
+PuzzleRunner solves lists of puzzles in parallel and times them.
+*/
+
+#define LOG_SUBSYSTEM SOLVER
+
+#include "batchSolver.hpp"
+#include "grid.hpp"
+#include "macros.hpp"
+#include "puzzleRunner.hpp"
+#include "solver.hpp"
+#include "solverStrategy.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace
+{
+        constexpr std::array<const char*, 3> ENGINE_NAMES = {"backtracking", "dlx", "batch"};
+
+        /*
+        Returns the nanoseconds elapsed since a point in time.
+
+        @param start The point in time.
+
+        @return The nanoseconds.
+        */
+        uint64_t elapsed(std::chrono::steady_clock::time_point start)
+        {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - start).count();
+        }
+} // namespace
+
+namespace Sudoku
+{
+// Class methods
+        /*
+        Constructor for the PuzzleRunner class.
+
+        @param engine The engine solving the puzzles.
+        @param threads The number of threads, 0 uses one per hardware thread.
+        */
+        PuzzleRunner::PuzzleRunner(Engine engine, size_t threads) : engine(engine), pool(threads)
+        {
+                LOG_TRACE("PuzzleRunner::PuzzleRunner() called");
+        }
+
+        /*
+        Destructor for the PuzzleRunner class.
+        */
+        PuzzleRunner::~PuzzleRunner()
+        {
+                LOG_TRACE("PuzzleRunner::~PuzzleRunner() called");
+        }
+// Runner methods
+        /*
+        Solves the puzzles in place.
+
+        @param grids The puzzles to solve, replaced by their solutions.
+        @param count The number of puzzles.
+        @param results Receives the status and the time of every puzzle.
+
+        @return The number of solved puzzles.
+
+        @note Unsolvable puzzles may be left partially filled.
+        */
+        size_t PuzzleRunner::solve(PackedGrid* grids, size_t count, RunResult* results)
+        {
+                LOG_TRACE("PuzzleRunner::solve() called");
+
+                // Every task writes its own range, so the tasks share nothing
+                for (size_t start = 0; start < count; start += CHUNK)
+                {
+                        size_t size = std::min(CHUNK, count - start);
+
+                        pool.submit([this, grids, results, start, size]
+                        {
+                                solveChunk(grids + start, size, results + start);
+                        });
+                }
+
+                pool.wait();
+
+                size_t solved = std::count_if(results, results + count, [](const RunResult& result)
+                {
+                        return result.status == SolverStatus::SOLVED;
+                });
+
+                LOG_DEBUG("PuzzleRunner::solve() result: Solved {} of {} puzzles", solved, count);
+
+                return solved;
+        }
+
+        /*
+        Solves one chunk of puzzles with a solver of its own.
+
+        @param grids The puzzles to solve.
+        @param count The number of puzzles.
+        @param results Receives the status and the time of every puzzle.
+        */
+        void PuzzleRunner::solveChunk(PackedGrid* grids, size_t count, RunResult* results) const
+        {
+                if (engine == Engine::BATCH)
+                {
+                        BatchSolver solver;
+                        std::array<SolverStatus, CHUNK> statuses;
+
+                        auto start = std::chrono::steady_clock::now();
+                        solver.solve(grids, count, statuses.data());
+                        uint64_t share = elapsed(start) / count;
+
+                        for (size_t k = 0; k < count; k++)
+                        {
+                                results[k] = {statuses[k], share};
+                        }
+
+                        return;
+                }
+
+                std::unique_ptr<SolverStrategy> solver = createSolver(
+                        engine == Engine::DANCING_LINKS ? SolverType::DANCING_LINKS : SolverType::BACKTRACKING);
+                Grid grid;
+
+                for (size_t k = 0; k < count; k++)
+                {
+                        grid.unpack(grids[k]);
+
+                        auto start = std::chrono::steady_clock::now();
+                        bool solved = solver->solve(grid);
+                        results[k] = {solved ? SolverStatus::SOLVED : SolverStatus::UNSOLVABLE, elapsed(start)};
+
+                        grid.pack(grids[k]);
+                }
+        }
+// Getters
+        /*
+        Returns the engine solving the puzzles.
+
+        @return The engine.
+        */
+        Engine PuzzleRunner::getEngine() const noexcept
+        {
+                LOG_TRACE("PuzzleRunner::getEngine() called");
+
+                return engine;
+        }
+
+        /*
+        Returns the number of threads solving the puzzles.
+
+        @return The number of threads.
+        */
+        size_t PuzzleRunner::getThreads() const noexcept
+        {
+                LOG_TRACE("PuzzleRunner::getThreads() called");
+
+                return pool.size();
+        }
+// Utility methods
+        /*
+        Looks up an engine by its name.
+
+        @param name The name: backtracking, dlx or batch.
+        @param engine The engine to store the result in.
+
+        @return True if the name is known, false otherwise.
+        */
+        bool PuzzleRunner::parseEngine(const std::string& name, Engine& engine) noexcept
+        {
+                for (size_t k = 0; k < ENGINE_NAMES.size(); k++)
+                {
+                        if (name == ENGINE_NAMES[k])
+                        {
+                                engine = static_cast<Engine>(k);
+                                return true;
+                        }
+                }
+
+                return false;
+        }
+
+        /*
+        Parses a number of threads. Only plain decimal numbers in [1, maxThreads()] are accepted,
+        so "-1" is not wrapped around to a huge count.
+
+        @param text The number.
+        @param threads The number of threads to store the result in.
+
+        @return True if the number is valid, false otherwise.
+        */
+        bool PuzzleRunner::parseThreads(const std::string& text, size_t& threads) noexcept
+        {
+                if (text.empty() || text.size() > 6)
+                {
+                        return false;
+                }
+
+                size_t value = 0;
+                for (char c : text)
+                {
+                        if (c < '0' || c > '9')
+                        {
+                                return false;
+                        }
+                        value = value * 10 + (c - '0');
+                }
+
+                if (value == 0 || value > maxThreads())
+                {
+                        return false;
+                }
+
+                threads = value;
+                return true;
+        }
+
+        /*
+        Returns the largest number of threads accepted by parseThreads(), four per hardware thread.
+
+        @return The number of threads.
+        */
+        size_t PuzzleRunner::maxThreads() noexcept
+        {
+                return 4 * std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        /*
+        Returns the name of an engine.
+
+        @param engine The engine.
+
+        @return The name, as accepted by parseEngine().
+        */
+        const char* PuzzleRunner::getName(Engine engine) noexcept
+        {
+                return ENGINE_NAMES[static_cast<size_t>(engine)];
+        }
+} // namespace Sudoku
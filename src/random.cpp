@@ -0,0 +1,83 @@
+/*
+Date: 18/10/2026
+
+Random is the xoshiro256** random number generator used by the game logic.
+*/
+
+#define LOG_SUBSYSTEM GENERATOR
+
+#include "macros.hpp"
+#include "random.hpp"
+#include <cstdint>
+#include <random>
+
+namespace Sudoku
+{
+// Class methods
+        /*
+        Constructor for the Random class. Seeds the generator from std::random_device.
+        */
+        Random::Random()
+                : Random(randomSeed())
+        {
+                LOG_TRACE("Random::Random() called");
+        }
+
+        /*
+        Constructor for the Random class.
+
+        @param seed The seed, the same seed always gives the same numbers.
+        */
+        Random::Random(uint64_t seed) noexcept
+        {
+                Random::seed(seed);
+        }
+// Generator methods
+        /*
+        Restarts the generator from a seed.
+
+        @param seed The seed.
+
+        @note The state is filled with SplitMix64, so even seeds like 0 or 1 give a good state.
+        */
+        void Random::seed(uint64_t seed) noexcept
+        {
+                for (uint64_t& word : state)
+                {
+                        seed += 0x9E3779B97F4A7C15ULL;
+                        word = mix(seed);
+                }
+        }
+// Utility methods
+        /*
+        Returns a seed read from std::random_device.
+
+        @return The seed.
+
+        @note This reads from the entropy source of the system, call it once per game, not per number.
+        */
+        uint64_t Random::randomSeed()
+        {
+                LOG_TRACE("Random::randomSeed() called");
+
+                std::random_device device;
+
+                return (static_cast<uint64_t>(device()) << 32) | device();
+        }
+
+        /*
+        Scrambles a 64-bit number with the SplitMix64 finalizer. Close inputs give unrelated
+        outputs, which makes it suitable to derive seeds from a counter.
+
+        @param value The number to scramble.
+
+        @return The scrambled number.
+        */
+        uint64_t Random::mix(uint64_t value) noexcept
+        {
+                value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+
+                return value ^ (value >> 31);
+        }
+} // namespace Sudoku
@@ -4,6 +4,8 @@ Date: 14/11/2024
 Scene class stores one scene of the application and all the objects in it.
 */
 
+#define LOG_SUBSYSTEM GUI
+
 #include "macros.hpp"
 #include "object.hpp"
 #include "scene.hpp"
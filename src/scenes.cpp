@@ -4,6 +4,8 @@ Date: 15/11/2024
 This file contains pre-made scenes for the GUI.
 */
 
+#define LOG_SUBSYSTEM GUI
+
 #include "colors.hpp"
 #include "command.hpp"
 #include "gameHandler.hpp"
@@ -15,6 +17,7 @@ This file contains pre-made scenes for the GUI.
 #include "scene.hpp"
 #include "scenes.hpp"
 #include "soundEffect.hpp"
+#include "tracer.hpp"
 #include <array>
 #include <bitset>
 #include <chrono>
@@ -45,6 +48,7 @@ namespace System
         void createDefaultScene(Scene& scene, sf::RenderWindow& window)
         {
                 LOG_TRACE("createDefaultScene() called.");
+                TRACE_SCOPE("createDefaultScene");
 
                 scene.clear();
 
@@ -76,6 +80,7 @@ namespace System
         void createBackgroundScene(Scene& scene, sf::RenderWindow& window)
         {
                 LOG_TRACE("createBackgroundScene() called.");
+                TRACE_SCOPE("createBackgroundScene");
 
                 scene.clear();
 
@@ -99,6 +104,7 @@ namespace System
         void createWelcomeScene(Scene& scene, GUI& gui)
         {
                 LOG_TRACE("createWelcomeScene() called.");
+                TRACE_SCOPE("createWelcomeScene");
 
                 scene.clear();
 
@@ -143,6 +149,7 @@ namespace System
         void createMainMenuScene(Scene& scene, GUI& gui)
         {
                 LOG_TRACE("createMainMenuScene() called.");
+                TRACE_SCOPE("createMainMenuScene");
 
                 scene.clear();
 
@@ -212,6 +219,7 @@ namespace System
         void createCreditsScene(Scene& scene, GUI& gui)
         {
                 LOG_TRACE("createCreditsScene() called.");
+                TRACE_SCOPE("createCreditsScene");
 
                 scene.clear();
 
@@ -259,6 +267,7 @@ namespace System
         void createHelpScene(Scene& scene, GUI& gui)
         {
                 LOG_TRACE("createHelpScene() called.");
+                TRACE_SCOPE("createHelpScene");
 
                 scene.clear();
 
@@ -308,6 +317,7 @@ namespace System
         void createNewGameScene(Scene& scene, GUI& gui)
         {
                 LOG_TRACE("createNewGameScene() called.");
+                TRACE_SCOPE("createNewGameScene");
 
                 scene.clear();
 
@@ -384,6 +394,7 @@ namespace System
                 // etc. to make editing easier
 
                 LOG_TRACE("createGameScene() called.");
+                TRACE_SCOPE("createGameScene");
 
                 scene.clear();
 
@@ -891,6 +902,7 @@ namespace System
         void createPauseScene(Scene& scene, GUI& gui)
         {
                 LOG_TRACE("createPauseScene() called.");
+                TRACE_SCOPE("createPauseScene");
 
                 scene.clear();
 
@@ -968,6 +980,7 @@ namespace System
         void createGameOverScene(Scene& scene, GUI& gui, bool win)
         {
                 LOG_TRACE("createGameOverScene() called.");
+                TRACE_SCOPE("createGameOverScene");
 
                 const std::string result = win ? "Won" : "Lost";
                 LOG_DEBUG("Game result: Player " + result);
@@ -1068,6 +1081,7 @@ namespace System
                 const std::chrono::microseconds& time)
         {
                 LOG_TRACE("createExecutionTimeScene() called.");
+                TRACE_SCOPE("createExecutionTimeScene");
 
                 scene.clear();
 
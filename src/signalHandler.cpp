@@ -1,3 +1,5 @@
+#define LOG_SUBSYSTEM DEFAULT
+
 #include "macros.hpp"
 #include "signalHandler.hpp"
 #include <csignal>
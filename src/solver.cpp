@@ -4,11 +4,17 @@ Date: 09/11/2024
 Solver is class which given a sudoku grid, solves it using backtracking.
 */
 
+#define LOG_SUBSYSTEM SOLVER
+
 #include "macros.hpp"
 #include "grid.hpp"
+#include "gridTables.hpp"
 #include "solver.hpp"
+#include "tracer.hpp"
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <cstddef>
 #include <iostream>
 #include <vector>
 
@@ -18,7 +24,8 @@ namespace Sudoku
         /*
         Constructor for the Solver class.
         */
-        Solver::Solver()
+        template <typename Stats>
+        BasicSolver<Stats>::BasicSolver()
         {
                 LOG_TRACE("Solver::Solver() called");
         }
@@ -26,7 +33,8 @@ namespace Sudoku
         /*
         Destructor for the Solver class.
         */
-        Solver::~Solver()
+        template <typename Stats>
+        BasicSolver<Stats>::~BasicSolver()
         {
                 LOG_TRACE("Solver::~Solver() called");
         }
@@ -38,16 +46,17 @@ namespace Sudoku
 
         @return True if the grid is solved, false otherwise.
 
-        @note Missing numbers are represented by zeros and the fixed numbers
-        are assumed to be correct.
+        @note Missing numbers are represented by zeros. Grids with conflicting
+        values are not solved.
         */
-        bool Solver::solve(Grid& grid)
+        template <typename Stats>
+        bool BasicSolver<Stats>::solve(Grid& grid)
         {
                 LOG_TRACE("Solver::solve() called");
+                TRACE_SCOPE("Solver::solve");
 
-                int zeroCount = grid.count(0);
-
-                bool result = backtrack(grid, 0, zeroCount);
+                start(grid);
+                bool result = resume(grid) == SolverStatus::SOLVED;
 
                 const std::string resultStr = result ? "Successfully solved"
                         : "Failed to solve";
@@ -58,45 +67,435 @@ namespace Sudoku
         }
 
         /*
-        Recursive function to solve the sudoku grid using backtracking.
+        Counts the solutions of the sudoku grid, stopping early at limit.
 
-        @param grid The grid to solve.
-        @param index The index of the cell to solve.
+        @param grid The grid to count the solutions of.
+        @param limit The number of solutions after which counting stops.
 
-        @return True if the grid is solved, false otherwise.
+        @return The number of solutions, at most limit.
+
+        @note Use limit 2 to check if a puzzle has a unique solution.
+        */
+        template <typename Stats>
+        int BasicSolver<Stats>::countSolutions(const Grid& grid, int limit)
+        {
+                LOG_TRACE("Solver::countSolutions() called");
+
+                if (limit <= 0)
+                {
+                        return 0;
+                }
+
+                Grid copy = grid;
+
+                start(copy, limit);
+                resume(copy);
+
+                return solutionCount;
+        }
+
+        /*
+        Prepares a new search of the grid. The search itself is run by resume().
+
+        @param grid The grid to search.
+        @param limit The number of solutions after which the search stops. With limit 1 the
+                solution is left in the grid, with a higher limit the solutions are only counted.
+
+        @note The grid must not be modified by anything else until the search is finished.
+        */
+        template <typename Stats>
+        void BasicSolver<Stats>::start(Grid& grid, int limit)
+        {
+                LOG_TRACE("Solver::start() called");
+
+                solutionLimit = limit;
+                solutionCount = 0;
+                depth = 0;
+                entering = true;
+                unsolvedCount = collectEmptyCells(grid);
+                status = grid.isValid() ? SolverStatus::IN_PROGRESS : SolverStatus::UNSOLVABLE;
+                stats = Stats();
+        }
+
+        /*
+        Runs the search prepared by start() for at most nodeBudget search nodes.
+
+        @param grid The grid passed to start().
+        @param nodeBudget The maximum number of search nodes to visit before pausing.
+
+        @return IN_PROGRESS if the budget ran out, SOLVED if the solution limit was reached and
+                UNSOLVABLE if the search space is exhausted.
+
+        @note Calling resume() again continues exactly where the search was paused, so long
+                solves can be time-sliced.
+        */
+        template <typename Stats>
+        SolverStatus BasicSolver<Stats>::resume(Grid& grid, size_t nodeBudget)
+        {
+                std::chrono::steady_clock::time_point begin;
+                if constexpr (Stats::ENABLED)
+                {
+                        begin = std::chrono::steady_clock::now();
+                }
+
+                while (status == SolverStatus::IN_PROGRESS)
+                {
+                        if (entering)
+                        {
+                                if (nodeBudget == 0)
+                                {
+                                        break;
+                                }
+                                nodeBudget--;
+
+                                enter(grid);
+                        }
+                        else
+                        {
+                                next(grid);
+                        }
+                }
+
+                if constexpr (Stats::ENABLED)
+                {
+                        stats.time(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - begin).count());
+                }
+
+                return status;
+        }
+// Search steps
+        /*
+        Enters a search node: fills the forced cells and pushes a frame for the cell to branch on.
+
+        @param grid The grid to search.
+        */
+        template <typename Stats>
+        void BasicSolver<Stats>::enter(Grid& grid) noexcept
+        {
+                int startCount = unsolvedCount;
+                int position = -1;
+
+                stats.node();
+
+                // Fill everything which follows logically and pick the most constrained cell
+                bool alive = propagate(grid, unsolvedCount)
+                        && (unsolvedCount == 0 || (position = chooseCell(grid, unsolvedCount)) >= 0);
+
+                if (alive && unsolvedCount == 0)
+                {
+                        // The solution is kept in the grid if it is the only one asked for
+                        if (++solutionCount >= solutionLimit)
+                        {
+                                status = SolverStatus::SOLVED;
+                                return;
+                        }
+
+                        alive = false;
+                }
+
+                if (!alive)
+                {
+                        stats.backtrack();
+                        undo(grid, unsolvedCount, startCount);
+                        unsolvedCount = startCount;
+                        entering = false;
+
+                        if (depth == 0)
+                        {
+                                finish();
+                        }
+
+                        return;
+                }
+
+                // Move the chosen cell out of the active part of the list
+                swapEmptyCells(position, unsolvedCount - 1);
+
+                Frame& frame = stack[depth++];
+                frame.cell = emptyCells[unsolvedCount - 1];
+                frame.candidates = grid.candidatesUnchecked(frame.cell);
+                frame.startCount = startCount;
+                frame.branchCount = unsolvedCount;
+                stats.depth(depth);
+
+                entering = false;
+        }
+
+        /*
+        Tries the next candidate of the top frame or pops the frame once it is exhausted.
+
+        @param grid The grid to search.
         */
-        bool Solver::backtrack(Grid& grid, size_t index, int zeroCount)
+        template <typename Stats>
+        void BasicSolver<Stats>::next(Grid& grid) noexcept
         {
-                LOG_TRACE("Solver::backtrack() called");
+                Frame& frame = stack[depth - 1];
 
-                // If there are no zeros left, the grid is solved
-                if (zeroCount <= 0 || index >= grid.size())
+                if (frame.candidates == 0)
                 {
-                        return true;
+                        // Restore the grid to how it was before the node was entered
+                        grid.setCellUnchecked(frame.cell, 0);
+                        undo(grid, frame.branchCount, frame.startCount);
+                        unsolvedCount = frame.startCount;
+
+                        if (--depth == 0)
+                        {
+                                finish();
+                        }
+
+                        return;
                 }
 
-                // Find next empty cell
-                while (grid.getCell(index) != 0 && index < grid.size())
+                // Try the candidates from the lowest value
+                stats.guess();
+                grid.setCellUnchecked(frame.cell, lowestValue(frame.candidates));
+                frame.candidates &= frame.candidates - 1;
+
+                unsolvedCount = frame.branchCount - 1;
+                entering = true;
+        }
+
+        /*
+        Ends the search after the whole search space was visited.
+        */
+        template <typename Stats>
+        void BasicSolver<Stats>::finish() noexcept
+        {
+                status = solutionCount > 0 ? SolverStatus::SOLVED : SolverStatus::UNSOLVABLE;
+        }
+// Search helpers
+        /*
+        Stores the indices of all the empty cells of the grid in emptyCells.
+
+        @param grid The grid to read.
+
+        @return The number of empty cells.
+        */
+        template <typename Stats>
+        int BasicSolver<Stats>::collectEmptyCells(const Grid& grid) noexcept
+        {
+                int emptyCount = 0;
+
+                for (size_t i = 0; i < grid.size(); i++)
                 {
-                        index++;
+                        if (grid.getCellUnchecked(i) == 0)
+                        {
+                                positions[i] = emptyCount;
+                                emptyCells[emptyCount++] = i;
+                        }
                 }
 
-                // Try all numbers from 1 to 9
-                for (int num = 1; num <= 9; num++)
+                return emptyCount;
+        }
+
+        /*
+        Swaps two entries of emptyCells and keeps positions in sync.
+
+        @param a The first position.
+        @param b The second position.
+        */
+        template <typename Stats>
+        void BasicSolver<Stats>::swapEmptyCells(int a, int b) noexcept
+        {
+                std::swap(emptyCells[a], emptyCells[b]);
+                positions[emptyCells[a]] = a;
+                positions[emptyCells[b]] = b;
+        }
+// Propagation
+        /*
+        Fills cells which are forced by the rules until nothing changes anymore:
+                Naked single: the cell has a single candidate left.
+                Hidden single: the value fits into a single cell of a row, column or box.
+
+        @param grid The grid to fill.
+        @param emptyCount The number of empty cells at the front of emptyCells, decreased for
+                every filled cell. The filled cells end up right behind the empty ones.
+
+        @return False if a contradiction was found, true otherwise.
+        */
+        template <typename Stats>
+        bool BasicSolver<Stats>::propagate(Grid& grid, int& emptyCount) noexcept
+        {
+                bool progress = true;
+
+                while (progress && emptyCount > 0)
                 {
-                        if (grid.isValidValueToSet(index, num))
+                        progress = false;
+
+                        // Naked singles, walking backwards so filled cells are not visited twice
+                        for (int i = emptyCount - 1; i >= 0; i--)
+                        {
+                                uint16_t candidates = grid.candidatesUnchecked(emptyCells[i]);
+
+                                if (candidates == 0)
+                                {
+                                        return false;
+                                }
+
+                                if ((candidates & (candidates - 1)) == 0)
+                                {
+                                        place(grid, i, lowestValue(candidates), emptyCount);
+                                        progress = true;
+                                }
+                        }
+
+                        // Hidden singles
+                        for (size_t house = 0; house < Tables::HOUSES.size(); house++)
                         {
-                                grid.setCell(index, num);
+                                uint16_t once = 0;
+                                uint16_t twice = 0;
+
+                                for (uint8_t cell : Tables::HOUSES[house])
+                                {
+                                        if (grid.getCellUnchecked(cell) == 0)
+                                        {
+                                                uint16_t candidates = grid.candidatesUnchecked(cell);
+                                                twice |= once & candidates;
+                                                once |= candidates;
+                                        }
+                                }
+
+                                // Every value must fit somewhere in the house
+                                if ((once | grid.houseMaskUnchecked(house)) != ALL_CANDIDATES)
+                                {
+                                        return false;
+                                }
+
+                                uint16_t hidden = once & ~twice;
 
-                                if (backtrack(grid, index + 1, zeroCount - 1))
+                                while (hidden != 0)
                                 {
-                                        return true;
+                                        int value = lowestValue(hidden);
+                                        hidden &= hidden - 1;
+
+                                        if (!placeHidden(grid, house, value, emptyCount))
+                                        {
+                                                return false;
+                                        }
+
+                                        progress = true;
                                 }
+                        }
+                }
+
+                return true;
+        }
+
+        /*
+        Fills the only cell of a house which can hold the value.
+
+        @param grid The grid to fill.
+        @param house The house of the hidden single.
+        @param value The value to place.
+        @param emptyCount The number of empty cells at the front of emptyCells.
+
+        @return False if no cell of the house can hold the value anymore, true otherwise.
+        */
+        template <typename Stats>
+        bool BasicSolver<Stats>::placeHidden(Grid& grid, size_t house, int value, int& emptyCount) noexcept
+        {
+                uint16_t bit = 1 << (value - 1);
 
-                                grid.setCell(index, 0);
+                for (uint8_t cell : Tables::HOUSES[house])
+                {
+                        if (grid.getCellUnchecked(cell) == 0 && (grid.candidatesUnchecked(cell) & bit))
+                        {
+                                place(grid, positions[cell], value, emptyCount);
+                                return true;
                         }
                 }
 
+                // Another hidden single took the cell
                 return false;
         }
-}
\ No newline at end of file
+
+        /*
+        Fills an empty cell and moves it right behind the empty cells.
+
+        @param grid The grid to fill.
+        @param position The position of the cell in emptyCells.
+        @param value The value to place.
+        @param emptyCount The number of empty cells at the front of emptyCells.
+        */
+        template <typename Stats>
+        void BasicSolver<Stats>::place(Grid& grid, int position, int value, int& emptyCount) noexcept
+        {
+                swapEmptyCells(position, emptyCount - 1);
+                grid.setCellUnchecked(emptyCells[emptyCount - 1], value);
+                emptyCount--;
+
+                stats.propagation();
+        }
+
+        /*
+        Empties the cells filled since the search node started.
+
+        @param grid The grid to restore.
+        @param emptyCount The current number of empty cells.
+        @param startCount The number of empty cells when the search node started.
+        */
+        template <typename Stats>
+        void BasicSolver<Stats>::undo(Grid& grid, int emptyCount, int startCount) noexcept
+        {
+                for (int i = emptyCount; i < startCount; i++)
+                {
+                        grid.setCellUnchecked(emptyCells[i], 0);
+                }
+        }
+
+        /*
+        Chooses the empty cell with the fewest candidates.
+
+        @param grid The grid to read.
+        @param emptyCount The number of empty cells at the front of emptyCells.
+
+        @return The position of the cell in emptyCells or -1 if a cell has no candidates.
+        */
+        template <typename Stats>
+        int BasicSolver<Stats>::chooseCell(const Grid& grid, int emptyCount) const noexcept
+        {
+                int best = 0;
+                int bestCount = 10;
+
+                for (int i = 0; i < emptyCount; i++)
+                {
+                        int count = popCount(grid.candidatesUnchecked(emptyCells[i]));
+
+                        if (count < bestCount)
+                        {
+                                if (count == 0)
+                                {
+                                        return -1;
+                                }
+
+                                best = i;
+                                bestCount = count;
+
+                                // A forced cell can not be beaten
+                                if (count == 1)
+                                {
+                                        break;
+                                }
+                        }
+                }
+
+                return best;
+        }
+// Getters
+        /*
+        Returns the statistics of the current or last search, reset by start().
+
+        @return The statistics, empty for Solver.
+        */
+        template <typename Stats>
+        const Stats& BasicSolver<Stats>::getStats() const noexcept
+        {
+                LOG_TRACE("Solver::getStats() called");
+
+                return stats;
+        }
+// Instantiations
+        template class BasicSolver<NoSolverStats>;
+        template class BasicSolver<SolverStats>;
+}
@@ -0,0 +1,42 @@
+/*
+Date: 18/10/2026
+
+This file implements the solver strategy factory.
+*/
+
+#define LOG_SUBSYSTEM SOLVER
+
+#include "dlxSolver.hpp"
+#include "macros.hpp"
+#include "solver.hpp"
+#include "solverStrategy.hpp"
+#include <memory>
+#include <stdexcept>
+
+namespace Sudoku
+{
+        /*
+        Creates a solver of the given type.
+
+        @param type The type of the solver.
+
+        @return The solver.
+
+        @throw std::invalid_argument if the type is unknown.
+        */
+        std::unique_ptr<SolverStrategy> createSolver(SolverType type)
+        {
+                LOG_TRACE("createSolver() called");
+
+                switch (type)
+                {
+                        case SolverType::BACKTRACKING:
+                                return std::make_unique<Solver>();
+                        case SolverType::DANCING_LINKS:
+                                return std::make_unique<DlxSolver>();
+                        default:
+                                LOG_ERROR("Invalid solver type: {}", static_cast<int>(type));
+                                throw std::invalid_argument("Invalid solver type");
+                }
+        }
+} // namespace Sudoku
@@ -4,6 +4,8 @@ Date: 24/11/2024
 Sound effect class manages the sound effects in the application.
 */
 
+#define LOG_SUBSYSTEM GUI
+
 #include "macros.hpp"
 #include "soundEffect.hpp"
 #include <algorithm>
@@ -4,10 +4,17 @@ Date: 09/11/2024
 Description: This file contains the main function.
 */
 
+#define LOG_SUBSYSTEM DEFAULT
+
 #include "application.hpp"
 #include "macros.hpp"
 #include "signalHandler.hpp"
+#include "tracer.hpp"
 #include <csignal>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
 // Uncomment if you want to enable logging to a file #include <filesystem>
 
 int main()
@@ -18,16 +25,43 @@ int main()
         // std::filesystem::path logPath = std::filesystem::current_path() / "log" / "log.txt";
         // SET_LOG_FILE(logPath.string());
         SET_LOG_LEVEL_DEBUG();
+        #ifdef LOG_ASYNC
+        SET_LOG_ASYNC();
+        #endif // LOG_ASYNC
         LOG_TRACE("main() called");
         // LOG_DEBUG("Log file set to: {}", logPath.string());
         #endif // DEVELOPMENT
 
+        TRACE_THREAD("main");
+
         // Set up signal handling
         std::signal(SIGINT, signalHandler);
         std::signal(SIGSEGV, signalHandler);
 
-        // Run the application
-        System::Application app;
+        // Run the application, it ends when it is destroyed
+        {
+                System::Application app;
+        }
+
+        #ifdef TRACING
+        // Write the spans for chrome://tracing or Perfetto, the thread pools are stopped by now
+        // The log is compiled out of release builds, so the outcome goes to stderr too
+        const char* tracePath = std::getenv("SUDOKU_TRACE");
+        const std::string path = tracePath != nullptr ? tracePath : "trace.json";
+        try
+        {
+                Sudoku::Tracer::write(path);
+                std::cerr << "Trace written to " << path << '\n';
+        }
+        catch (const std::exception& e)
+        {
+                LOG_ERROR("Failed to write the trace: {}", e.what());
+                std::cerr << "Failed to write the trace to " << path << ": " << e.what() << '\n';
+        }
+        #endif // TRACING
+
+        // Write what is still queued by the asynchronous logger
+        SHUTDOWN_LOG();
 
         return 0;
 }
\ No newline at end of file
@@ -0,0 +1,219 @@
+/*
+Date: 18/10/2026
+
+ThreadPool runs tasks on a fixed number of work stealing worker threads.
+*/
+
+#define LOG_SUBSYSTEM CORE
+
+#include "macros.hpp"
+#include "threadPool.hpp"
+#include "tracer.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace Sudoku
+{
+namespace
+{
+        thread_local const ThreadPool* currentPool = nullptr;                  // Pool of the calling worker
+        thread_local size_t currentIndex = 0;                                   // Index of the calling worker
+} // namespace
+
+// Class methods
+        /*
+        Constructor for the ThreadPool class. Starts the workers.
+
+        @param threads The number of workers, 0 uses one per hardware thread.
+        */
+        ThreadPool::ThreadPool(size_t threads)
+        {
+                LOG_TRACE("ThreadPool::ThreadPool() called");
+
+                if (threads == 0)
+                {
+                        threads = std::max(1u, std::thread::hardware_concurrency());
+                }
+
+                for (size_t i = 0; i < threads; i++)
+                {
+                        queues.push_back(std::make_unique<Queue>());
+                }
+
+                for (size_t i = 0; i < threads; i++)
+                {
+                        workers.emplace_back(&ThreadPool::run, this, i);
+                }
+
+                LOG_DEBUG("ThreadPool::ThreadPool() started {} workers", threads);
+        }
+
+        /*
+        Destructor for the ThreadPool class. Finishes the queued tasks and joins the workers.
+        */
+        ThreadPool::~ThreadPool()
+        {
+                LOG_TRACE("ThreadPool::~ThreadPool() called");
+
+                {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        stopping = true;
+                }
+                wake.notify_all();
+
+                for (std::thread& worker : workers)
+                {
+                        worker.join();
+                }
+        }
+// Task methods
+        /*
+        Queues a task to be run by one of the workers.
+
+        @param task The task to run.
+        */
+        void ThreadPool::submit(std::function<void()> task)
+        {
+                LOG_TRACE("ThreadPool::submit() called");
+
+                size_t index = currentPool == this ? currentIndex
+                        : nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+
+                pending.fetch_add(1);
+
+                // Counted before it is queued, so a worker never takes a task it did not see counted.
+                // Taking the lock makes sure a worker about to sleep sees the new task.
+                {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        queued.fetch_add(1);
+                }
+
+                {
+                        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+                        queues[index]->tasks.push_back(std::move(task));
+                }
+                wake.notify_one();
+        }
+
+        /*
+        Blocks until all the submitted tasks finished.
+
+        @note Must not be called from a worker.
+        */
+        void ThreadPool::wait()
+        {
+                LOG_TRACE("ThreadPool::wait() called");
+
+                std::unique_lock<std::mutex> lock(mutex);
+                done.wait(lock, [this] { return pending.load() == 0; });
+        }
+// Utility methods
+        /*
+        Returns the number of workers.
+
+        @return The number of workers.
+        */
+        size_t ThreadPool::size() const noexcept
+        {
+                LOG_TRACE("ThreadPool::size() called");
+
+                return workers.size();
+        }
+// Worker methods
+        /*
+        Main loop of a worker.
+
+        @param index The index of the worker.
+        */
+        void ThreadPool::run(size_t index)
+        {
+                currentPool = this;
+                currentIndex = index;
+                TRACE_THREAD("worker " + std::to_string(index));
+
+                std::function<void()> task;
+
+                while (true)
+                {
+                        if (pop(index, task) || steal(index, task))
+                        {
+                                queued.fetch_sub(1);
+                                task();
+                                task = nullptr;
+
+                                if (pending.fetch_sub(1) == 1)
+                                {
+                                        std::lock_guard<std::mutex> lock(mutex);
+                                        done.notify_all();
+                                }
+
+                                continue;
+                        }
+
+                        std::unique_lock<std::mutex> lock(mutex);
+                        wake.wait(lock, [this] { return stopping || queued.load() > 0; });
+
+                        if (stopping && queued.load() == 0)
+                        {
+                                return;
+                        }
+                }
+        }
+
+        /*
+        Takes the newest task from the own queue of the worker.
+
+        @param index The index of the worker.
+        @param task Receives the task.
+
+        @return True if a task was taken, false if the queue is empty.
+        */
+        bool ThreadPool::pop(size_t index, std::function<void()>& task)
+        {
+                Queue& queue = *queues[index];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+
+                if (queue.tasks.empty())
+                {
+                        return false;
+                }
+
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+
+                return true;
+        }
+
+        /*
+        Takes the oldest task from the queue of another worker.
+
+        @param index The index of the stealing worker.
+        @param task Receives the task.
+
+        @return True if a task was stolen, false if all the other queues are empty.
+        */
+        bool ThreadPool::steal(size_t index, std::function<void()>& task)
+        {
+                for (size_t offset = 1; offset < queues.size(); offset++)
+                {
+                        Queue& queue = *queues[(index + offset) % queues.size()];
+                        std::lock_guard<std::mutex> lock(queue.mutex);
+
+                        if (!queue.tasks.empty())
+                        {
+                                task = std::move(queue.tasks.front());
+                                queue.tasks.pop_front();
+
+                                return true;
+                        }
+                }
+
+                return false;
+        }
+} // namespace Sudoku
@@ -0,0 +1,273 @@
+/*
+Date: 18/10/2026
+
+Tracer records timed spans into per thread ring buffers and writes them as a Chrome trace.
+*/
+
+#define LOG_SUBSYSTEM CORE
+
+#include "macros.hpp"
+#include "tracer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+        /*
+        Writes a string as a JSON string.
+
+        @param stream The stream to write to.
+        @param text The string.
+        */
+        void writeString(std::ostream& stream, const std::string& text)
+        {
+                stream << '"';
+                for (char c : text)
+                {
+                        if (c == '"' || c == '\\')
+                        {
+                                stream << '\\';
+                        }
+                        stream << (static_cast<unsigned char>(c) < 0x20 ? ' ' : c);
+                }
+                stream << '"';
+        }
+
+        /*
+        Writes nanoseconds as the microseconds of a Chrome trace.
+
+        @param stream The stream to write to.
+        @param nanoseconds The nanoseconds.
+        */
+        void writeMicroseconds(std::ostream& stream, uint64_t nanoseconds)
+        {
+                char text[32];
+                std::snprintf(text, sizeof(text), "%.3f", nanoseconds / 1000.0);
+                stream << text;
+        }
+} // namespace
+
+namespace Sudoku
+{
+// Recording methods
+        /*
+        Returns the current time of the steady clock.
+
+        @return The nanoseconds since the epoch of the clock.
+        */
+        uint64_t Tracer::now() noexcept
+        {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        /*
+        Records a finished span in the buffer of the calling thread.
+
+        @param name The name of the span, a string which outlives the tracer.
+        @param start The start of the span, see now().
+        @param end The end of the span, see now().
+        */
+        void Tracer::record(const char* name, uint64_t start, uint64_t end)
+        {
+                Buffer& current = buffer();
+                size_t count = current.count.load(std::memory_order_relaxed);
+
+                current.spans[count & (CAPACITY - 1)] = {name, start, end};
+                current.count.store(count + 1, std::memory_order_release);
+        }
+
+        /*
+        Names the calling thread in the trace.
+
+        @param name The name.
+        */
+        void Tracer::setThreadName(const std::string& name)
+        {
+                LOG_TRACE("Tracer::setThreadName() called");
+
+                Buffer& current = buffer();
+                std::lock_guard<std::mutex> lock(registry().mutex);
+
+                current.name = name;
+        }
+// Output methods
+        /*
+        Writes the recorded spans of all the threads as a Chrome trace (JSON object format).
+
+        @param path The path of the trace.
+
+        @throw std::runtime_error if the trace can not be written.
+
+        @note Must be called once the traced threads have stopped (joined or blocked for good): the
+                spans are read without a lock, a thread recording while they are written races with
+                the writer and may garble the trace.
+        */
+        void Tracer::write(const std::string& path)
+        {
+                LOG_TRACE("Tracer::write() called");
+
+                std::ofstream file(path);
+                if (!file)
+                {
+                        LOG_ERROR("Tracer::write() failed to create {}", path);
+                        throw std::runtime_error("Failed to create " + path);
+                }
+
+                Registry& spans = registry();
+                std::lock_guard<std::mutex> lock(spans.mutex);
+
+                // Time is written relative to the first span, the clock's epoch is arbitrary
+                uint64_t origin = UINT64_MAX;
+                for (const std::unique_ptr<Buffer>& current : spans.buffers)
+                {
+                        size_t count = std::min(current->count.load(std::memory_order_acquire), CAPACITY);
+                        for (size_t k = 0; k < count; k++)
+                        {
+                                origin = std::min(origin, current->spans[k].start);
+                        }
+                }
+
+                file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+                bool first = true;
+
+                for (const std::unique_ptr<Buffer>& current : spans.buffers)
+                {
+                        file << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+                                << current->thread << ",\"args\":{\"name\":";
+                        writeString(file, current->name);
+                        file << "}}";
+                        first = false;
+
+                        size_t count = current->count.load(std::memory_order_acquire);
+                        for (size_t k = count > CAPACITY ? count - CAPACITY : 0; k < count; k++)
+                        {
+                                const Span& span = current->spans[k & (CAPACITY - 1)];
+
+                                file << ",\n{\"name\":";
+                                writeString(file, span.name);
+                                file << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << current->thread << ",\"ts\":";
+                                writeMicroseconds(file, span.start - origin);
+                                file << ",\"dur\":";
+                                writeMicroseconds(file, span.end - span.start);
+                                file << '}';
+                        }
+                }
+
+                file << "\n]}\n";
+                file.flush();
+
+                if (!file)
+                {
+                        LOG_ERROR("Tracer::write() failed to write {}", path);
+                        throw std::runtime_error("Failed to write " + path);
+                }
+
+                LOG_INFO("Trace written to {}", path);
+        }
+
+        /*
+        Returns the number of spans kept in all the buffers.
+
+        @return The number of spans.
+        */
+        size_t Tracer::size()
+        {
+                LOG_TRACE("Tracer::size() called");
+
+                Registry& spans = registry();
+                std::lock_guard<std::mutex> lock(spans.mutex);
+
+                size_t size = 0;
+                for (const std::unique_ptr<Buffer>& current : spans.buffers)
+                {
+                        size += std::min(current->count.load(std::memory_order_acquire), CAPACITY);
+                }
+
+                return size;
+        }
+
+        /*
+        Drops all the recorded spans and frees the buffers of the threads which ended. The running
+        threads keep their buffers and names.
+
+        @note Must not be called while a traced thread records spans.
+        */
+        void Tracer::clear()
+        {
+                LOG_TRACE("Tracer::clear() called");
+
+                Registry& spans = registry();
+                std::lock_guard<std::mutex> lock(spans.mutex);
+
+                spans.buffers.erase(std::remove_if(spans.buffers.begin(), spans.buffers.end(),
+                        [](const std::unique_ptr<Buffer>& current) { return current->finished; }),
+                        spans.buffers.end());
+
+                for (const std::unique_ptr<Buffer>& current : spans.buffers)
+                {
+                        current->count.store(0, std::memory_order_release);
+                }
+        }
+// Buffer methods
+        /*
+        Returns the buffer of the calling thread, registering it on the first call.
+
+        @return The buffer.
+        */
+        Tracer::Buffer& Tracer::buffer()
+        {
+                // Spans recorded by thread_local destructors running after owner still go to current
+                thread_local Buffer* current = nullptr;
+                thread_local Owner owner;
+
+                if (current == nullptr)
+                {
+                        Registry& spans = registry();
+                        std::lock_guard<std::mutex> lock(spans.mutex);
+
+                        spans.buffers.push_back(std::make_unique<Buffer>());
+                        current = spans.buffers.back().get();
+                        current->thread = spans.threads++;
+                        current->name = "thread " + std::to_string(current->thread);
+                        owner.buffer = current;
+                }
+
+                return *current;
+        }
+
+        /*
+        Destructor for the Owner class, runs when its thread ends. The buffer is kept until the
+        next clear(), so the spans of the thread can still be written.
+        */
+        Tracer::Owner::~Owner()
+        {
+                if (buffer != nullptr)
+                {
+                        std::lock_guard<std::mutex> lock(registry().mutex);
+
+                        buffer->finished = true;
+                }
+        }
+
+        /*
+        Returns the buffers of all the threads. Never destroyed, so threads ending after main()
+        can still record spans.
+
+        @return The registry.
+        */
+        Tracer::Registry& Tracer::registry()
+        {
+                static Registry* spans = new Registry();
+
+                return *spans;
+        }
+}
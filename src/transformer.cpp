@@ -0,0 +1,127 @@
+/*
+Date: 18/10/2026
+
+Transformer turns a grid into an equivalent one with a random symmetry of the sudoku grid.
+*/
+
+#define LOG_SUBSYSTEM GENERATOR
+
+#include "grid.hpp"
+#include "macros.hpp"
+#include "random.hpp"
+#include "transformer.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+
+namespace Sudoku
+{
+// Transformer methods
+        /*
+        Returns the transformation which leaves every grid as it is.
+
+        @return The identity.
+        */
+        Transformation Transformer::identity() noexcept
+        {
+                Transformation transformation;
+
+                std::iota(transformation.digits.begin(), transformation.digits.end(), 0);
+                std::iota(transformation.rows.begin(), transformation.rows.end(), 0);
+                std::iota(transformation.cols.begin(), transformation.cols.end(), 0);
+                transformation.transpose = false;
+
+                return transformation;
+        }
+
+        /*
+        Draws a uniformly random transformation.
+
+        @param random The random number generator.
+
+        @return The transformation.
+        */
+        Transformation Transformer::random(Random& random)
+        {
+                LOG_TRACE("Transformer::random() called");
+
+                Transformation transformation = identity();
+
+                random.shuffle(transformation.digits.begin() + 1, transformation.digits.end());
+                shuffleLines(transformation.rows, random);
+                shuffleLines(transformation.cols, random);
+                transformation.transpose = random.below(2) == 1;
+
+                return transformation;
+        }
+
+        /*
+        Applies a transformation to a grid. The fixed flags move with their cells.
+
+        @param transformation The transformation.
+        @param grid The grid to transform.
+        @param result The grid to store the transformed grid in, must not be grid.
+        */
+        void Transformer::apply(const Transformation& transformation, const Grid& grid, Grid& result)
+        {
+                LOG_TRACE("Transformer::apply() called");
+
+                // Start from an empty grid so no house ever holds a value twice on the way
+                result = Grid();
+
+                for (size_t row = 0; row < 9; row++)
+                {
+                        for (size_t col = 0; col < 9; col++)
+                        {
+                                size_t source = transformation.transpose
+                                        ? transformation.rows[col] * 9 + transformation.cols[row]
+                                        : transformation.rows[row] * 9 + transformation.cols[col];
+                                size_t target = row * 9 + col;
+
+                                result.setCellUnchecked(target, transformation.digits[grid.getCellUnchecked(source)]);
+                                if (grid.isFixed(source))
+                                {
+                                        result.setFixed(target);
+                                }
+                        }
+                }
+        }
+
+        /*
+        Applies a transformation to a grid in place.
+
+        @param transformation The transformation.
+        @param grid The grid to transform.
+        */
+        void Transformer::apply(const Transformation& transformation, Grid& grid)
+        {
+                LOG_TRACE("Transformer::apply(Grid&) called");
+
+                const Grid copy = grid;
+                apply(transformation, copy, grid);
+        }
+
+        /*
+        Shuffles the lines inside each group of three and the groups themselves.
+
+        @param lines The old line of every new line, the identity on entry.
+        @param random The random number generator.
+        */
+        void Transformer::shuffleLines(std::array<uint8_t, 9>& lines, Random& random)
+        {
+                std::array<uint8_t, 3> groups = {0, 1, 2};
+                random.shuffle(groups.begin(), groups.end());
+
+                for (size_t group = 0; group < 3; group++)
+                {
+                        std::array<uint8_t, 3> inside = {0, 1, 2};
+                        random.shuffle(inside.begin(), inside.end());
+
+                        for (size_t k = 0; k < 3; k++)
+                        {
+                                lines[group * 3 + k] = groups[group] * 3 + inside[k];
+                        }
+                }
+        }
+} // namespace Sudoku
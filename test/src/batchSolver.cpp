@@ -0,0 +1,121 @@
+/*
+Date: 18/10/2026
+
+This file provides a few tests for the BatchSolver class.
+*/
+
+#ifndef TEST
+#error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
+#else
+
+#include "batchSolver.hpp"
+#include "grid.hpp"
+#include "solver.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+/*
+Test for the BatchSolver::solve() method on a mix of puzzles with every supported instruction set.
+
+Expected: The solvable puzzles are solved keeping their givens, the others are reported as
+        unsolvable and left untouched.
+*/
+TEST(BatchSolver, Solve)
+{
+        const std::vector<std::string> puzzles = {
+                // Singles only
+                "530070000600195000098000060800060003400803001700020006060000280000419005000080079",
+                // Needs guessing
+                "000000010400000000020000000000050407008000300001090000300400200050100000000806000",
+                // Two fives in the first row
+                "500000005000000000000000000000000000000000000000000000000000000000000000000000000",
+                // No value is left for the first cell
+                "023456789100000000000000000000000000000000000000000000000000000000000000000000000",
+                // Empty grid
+                "000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+        };
+        const std::vector<Sudoku::SolverStatus> expected = {
+                Sudoku::SolverStatus::SOLVED,
+                Sudoku::SolverStatus::SOLVED,
+                Sudoku::SolverStatus::UNSOLVABLE,
+                Sudoku::SolverStatus::UNSOLVABLE,
+                Sudoku::SolverStatus::SOLVED
+        };
+
+        for (Sudoku::InstructionSet instructionSet : {Sudoku::InstructionSet::SCALAR,
+                Sudoku::InstructionSet::SSE2, Sudoku::InstructionSet::AVX2})
+        {
+                if (!Sudoku::BatchSolver::isSupported(instructionSet))
+                {
+                        continue;
+                }
+
+                Sudoku::BatchSolver solver(instructionSet);
+
+                // More puzzles than lanes so the last group is only partly filled
+                std::vector<Sudoku::PackedGrid> grids;
+                std::vector<Sudoku::PackedGrid> original;
+                Sudoku::Grid grid;
+
+                for (size_t k = 0; k < 7 * puzzles.size(); k++)
+                {
+                        const std::string& puzzle = puzzles[k % puzzles.size()];
+
+                        grid.clear();
+                        for (size_t i = 0; i < grid.size(); i++)
+                        {
+                                grid.setCell(i, puzzle[i] - '0');
+                        }
+
+                        grids.emplace_back();
+                        grid.pack(grids.back());
+                }
+
+                original = grids;
+                std::vector<Sudoku::SolverStatus> statuses(grids.size());
+
+                ASSERT_EQ(solver.solve(grids.data(), grids.size(), statuses.data()), 7 * 3);
+
+                for (size_t k = 0; k < grids.size(); k++)
+                {
+                        const std::string& puzzle = puzzles[k % puzzles.size()];
+
+                        ASSERT_EQ(statuses[k], expected[k % puzzles.size()]);
+
+                        if (statuses[k] == Sudoku::SolverStatus::UNSOLVABLE)
+                        {
+                                ASSERT_EQ(grids[k].cells, original[k].cells);
+                                continue;
+                        }
+
+                        grid.unpack(grids[k]);
+                        ASSERT_TRUE(grid.isSolved());
+
+                        for (size_t i = 0; i < grid.size(); i++)
+                        {
+                                if (puzzle[i] != '0')
+                                {
+                                        ASSERT_EQ(grid.getCell(i), puzzle[i] - '0');
+                                }
+                        }
+                }
+        }
+}
+
+/*
+Test for the instruction set detection.
+
+Expected: The detected instruction set is supported and the scalar kernel is always available.
+*/
+TEST(BatchSolver, InstructionSet)
+{
+        Sudoku::BatchSolver solver;
+
+        ASSERT_TRUE(Sudoku::BatchSolver::isSupported(Sudoku::InstructionSet::SCALAR));
+        ASSERT_TRUE(Sudoku::BatchSolver::isSupported(solver.getInstructionSet()));
+        ASSERT_EQ(solver.getInstructionSet(), Sudoku::BatchSolver::detectInstructionSet());
+        ASSERT_GE(solver.getLanes(), 1u);
+}
+
+#endif // !TEST
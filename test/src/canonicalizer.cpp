@@ -0,0 +1,370 @@
+/*
+Date: 18/10/2026
+
+This file provides a few tests for the Canonicalizer class.
+*/
+
+#ifndef TEST
+#error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
+#else
+
+#include "canonicalizer.hpp"
+#include "digger.hpp"
+#include "generator.hpp"
+#include "grid.hpp"
+#include "random.hpp"
+#include "transformer.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+        /*
+        Returns the values of a grid in reading order.
+
+        @param grid The grid.
+
+        @return The values.
+        */
+        std::array<uint8_t, 81> values(const Sudoku::Grid& grid)
+        {
+                std::array<uint8_t, 81> result;
+
+                for (size_t i = 0; i < result.size(); i++)
+                {
+                        result[i] = grid.getCell(i);
+                }
+
+                return result;
+        }
+
+        /*
+        Fills a grid from 81 digits, 0 for the empty cells.
+
+        @param text The digits in reading order.
+        @param grid The grid to fill, must be empty.
+        */
+        void load(const std::string& text, Sudoku::Grid& grid)
+        {
+                for (size_t i = 0; i < text.size(); i++)
+                {
+                        grid.setCell(i, text[i] - '0');
+                }
+        }
+
+        /*
+        Returns the 6^4 orders of the rows (or columns) which keep every band (or stack) together.
+
+        @return The old row of every new row, for every order.
+        */
+        std::vector<std::array<uint8_t, 9>> lineOrders()
+        {
+                std::array<uint8_t, 3> three = {0, 1, 2};
+                std::vector<std::array<uint8_t, 3>> permutations;
+                do
+                {
+                        permutations.push_back(three);
+                } while (std::next_permutation(three.begin(), three.end()));
+
+                std::vector<std::array<uint8_t, 9>> orders;
+                for (const std::array<uint8_t, 3>& bands : permutations)
+                {
+                        for (const std::array<uint8_t, 3>& first : permutations)
+                        {
+                                for (const std::array<uint8_t, 3>& second : permutations)
+                                {
+                                        for (const std::array<uint8_t, 3>& third : permutations)
+                                        {
+                                                std::array<std::array<uint8_t, 3>, 3> lines = {first, second, third};
+                                                std::array<uint8_t, 9> order;
+                                                for (size_t k = 0; k < 9; k++)
+                                                {
+                                                        order[k] = 3 * bands[k / 3] + lines[k / 3][k % 3];
+                                                }
+                                                orders.push_back(order);
+                                        }
+                                }
+                        }
+                }
+
+                return orders;
+        }
+
+        /*
+        Computes the canonical form of a puzzle by trying every symmetry: both transpositions,
+        every order of the rows and every order of the columns, each relabeled in the order the
+        values first occur. The smallest solution wins and the smallest puzzle breaks the ties
+        between the automorphisms of the solution.
+
+        @param puzzle The puzzle, may be the solution itself.
+        @param solution The solution.
+
+        @return The canonical form of the puzzle.
+        */
+        std::array<uint8_t, 81> bruteForce(const Sudoku::Grid& puzzle, const Sudoku::Grid& solution)
+        {
+                // The 36 orders after an order share its top two rows, see lineOrders()
+                constexpr size_t SHARED = 36;
+                std::vector<std::array<uint8_t, 9>> orders = lineOrders();
+                std::array<uint8_t, 81> best;
+                std::array<uint8_t, 81> bestPuzzle;
+                best.fill(10);
+
+                for (int transpose = 0; transpose < 2; transpose++)
+                {
+                        std::array<uint8_t, 81> cells;
+                        std::array<uint8_t, 81> givens;
+                        for (size_t i = 0; i < 81; i++)
+                        {
+                                size_t source = transpose ? (i % 9) * 9 + i / 9 : i;
+                                cells[i] = solution.getCell(source);
+                                givens[i] = puzzle.getCell(source);
+                        }
+
+                        for (size_t group = 0; group < orders.size(); group += SHARED)
+                        {
+                                for (const std::array<uint8_t, 9>& cols : orders)
+                                {
+                                        // The top row becomes 123456789, which fixes the labels
+                                        std::array<uint8_t, 10> label{};
+                                        for (size_t col = 0; col < 9; col++)
+                                        {
+                                                label[cells[orders[group][0] * 9 + cols[col]]] = col + 1;
+                                        }
+
+                                        // Skips the row orders of the group if the second row is already larger
+                                        std::array<uint8_t, 9> second;
+                                        for (size_t col = 0; col < 9; col++)
+                                        {
+                                                second[col] = label[cells[orders[group][1] * 9 + cols[col]]];
+                                        }
+                                        if (std::lexicographical_compare(best.begin() + 9, best.begin() + 18,
+                                                second.begin(), second.end()))
+                                        {
+                                                continue;
+                                        }
+
+                                        for (size_t k = group; k < group + SHARED; k++)
+                                        {
+                                                const std::array<uint8_t, 9>& rows = orders[k];
+                                                std::array<uint8_t, 81> image;
+                                                std::array<uint8_t, 81> relabeled;
+
+                                                for (size_t i = 0; i < 81; i++)
+                                                {
+                                                        size_t source = rows[i / 9] * 9 + cols[i % 9];
+                                                        image[i] = label[cells[source]];
+                                                        relabeled[i] = givens[source] == 0 ? 0 : label[givens[source]];
+                                                }
+
+                                                if (image < best || (image == best && relabeled < bestPuzzle))
+                                                {
+                                                        best = image;
+                                                        bestPuzzle = relabeled;
+                                                }
+                                        }
+                                }
+                        }
+                }
+
+                return bestPuzzle;
+        }
+} // namespace
+
+/*
+Test for Canonicalizer::canonicalize() with solved grids.
+
+Expected: Every transformation of a grid has the same canonical form, which is a solved grid
+starting with 123456789, no larger than any of them and its own canonical form.
+*/
+TEST(Canonicalizer, Solved)
+{
+        Sudoku::Canonicalizer canonicalizer;
+        Sudoku::Generator generator;
+        Sudoku::Random random(1);
+
+        for (int n = 0; n < 10; n++)
+        {
+                Sudoku::Grid grid;
+                Sudoku::Grid canonical;
+                generator.generate(grid, random);
+                canonicalizer.canonicalize(grid, canonical);
+
+                ASSERT_TRUE(canonical.isSolved());
+                for (size_t i = 0; i < 9; i++)
+                {
+                        ASSERT_EQ(canonical.getCell(i), i + 1);
+                }
+
+                Sudoku::Grid again;
+                canonicalizer.canonicalize(canonical, again);
+                ASSERT_EQ(values(again), values(canonical));
+
+                for (int k = 0; k < 20; k++)
+                {
+                        Sudoku::Grid image;
+                        Sudoku::Grid result;
+                        Sudoku::Transformer::apply(Sudoku::Transformer::random(random), grid, image);
+                        canonicalizer.canonicalize(image, result);
+
+                        ASSERT_EQ(values(result), values(canonical));
+                        ASSERT_LE(values(canonical), values(image));
+                }
+        }
+}
+
+/*
+Test for Canonicalizer::canonicalize() with the smallest grid there is.
+
+Expected: Its transformations are all mapped back to it.
+*/
+TEST(Canonicalizer, Minimal)
+{
+        const std::string minimal = "123456789456789123789123456214365897365897214897214365531642978642978531978531642";
+        Sudoku::Canonicalizer canonicalizer;
+        Sudoku::Random random(2);
+        Sudoku::Grid grid;
+        Sudoku::Grid expected;
+        load(minimal, grid);
+        load(minimal, expected);
+
+        for (int k = 0; k < 50; k++)
+        {
+                Sudoku::Grid image;
+                Sudoku::Grid result;
+                Sudoku::Transformer::apply(Sudoku::Transformer::random(random), grid, image);
+                canonicalizer.canonicalize(image, result);
+
+                ASSERT_EQ(values(result), values(expected));
+        }
+}
+
+/*
+Test for Canonicalizer::canonicalize() against a search of every symmetry.
+
+Expected: The canonical form of a random grid, of the highly automorphic minimal grid and of a
+puzzle of the minimal grid is the smallest grid of its class, also when the result is written
+over the input.
+*/
+TEST(Canonicalizer, BruteForce)
+{
+        const std::string minimal = "123456789456789123789123456214365897365897214897214365531642978642978531978531642";
+        Sudoku::Canonicalizer canonicalizer;
+        Sudoku::Generator generator;
+        Sudoku::Random random(5);
+        Sudoku::Grid grid;
+        Sudoku::Grid result;
+
+        generator.generate(grid, random);
+        canonicalizer.canonicalize(grid, result);
+        ASSERT_EQ(values(result), bruteForce(grid, grid));
+
+        Sudoku::Grid automorphic;
+        Sudoku::Grid solution;
+        load(minimal, automorphic);
+        Sudoku::Transformer::apply(Sudoku::Transformer::random(random), automorphic, solution);
+        canonicalizer.canonicalize(solution, result);
+        ASSERT_EQ(values(result), bruteForce(solution, solution));
+        ASSERT_EQ(values(result), values(automorphic));
+
+        // Every automorphism of the solution is a candidate for the puzzle
+        Sudoku::Grid puzzle = solution;
+        for (size_t i = 0; i < puzzle.size(); i++)
+        {
+                if (random() % 3 != 0)
+                {
+                        puzzle.setCell(i, 0);
+                }
+        }
+        std::array<uint8_t, 81> expected = bruteForce(puzzle, solution);
+        canonicalizer.canonicalize(puzzle, solution, result);
+        ASSERT_EQ(values(result), expected);
+
+        // The result may be the input
+        canonicalizer.canonicalize(puzzle, solution, puzzle);
+        ASSERT_EQ(values(puzzle), expected);
+        canonicalizer.canonicalize(solution, solution);
+        ASSERT_EQ(values(solution), values(automorphic));
+}
+
+/*
+Test for Canonicalizer::canonicalize() and Canonicalizer::fingerprint() with puzzles.
+
+Expected: Transformations of a puzzle share its canonical form and fingerprint, different
+puzzles of the same solution do not.
+*/
+TEST(Canonicalizer, Puzzle)
+{
+        Sudoku::Canonicalizer canonicalizer;
+        Sudoku::Digger digger;
+        Sudoku::Random random(3);
+        Sudoku::Grid puzzle;
+        Sudoku::Grid solution;
+        digger.generate(puzzle, solution, 28, random);
+
+        Sudoku::Grid canonical;
+        canonicalizer.canonicalize(puzzle, canonical);
+        uint64_t fingerprint = canonicalizer.fingerprint(puzzle);
+        ASSERT_EQ(fingerprint, Sudoku::Canonicalizer::hash(canonical));
+        ASSERT_EQ(canonical.count(0), puzzle.count(0));
+
+        for (int k = 0; k < 20; k++)
+        {
+                Sudoku::Transformation transformation = Sudoku::Transformer::random(random);
+                Sudoku::Grid image;
+                Sudoku::Grid imageSolution;
+                Sudoku::Grid result;
+                Sudoku::Transformer::apply(transformation, puzzle, image);
+                Sudoku::Transformer::apply(transformation, solution, imageSolution);
+
+                canonicalizer.canonicalize(image, imageSolution, result);
+                ASSERT_EQ(values(result), values(canonical));
+                ASSERT_EQ(canonicalizer.fingerprint(image), fingerprint);
+        }
+
+        // Removing a given keeps the solution but changes the class
+        for (size_t i = 0; i < puzzle.size(); i++)
+        {
+                if (puzzle.getCell(i) != 0)
+                {
+                        Sudoku::Grid smaller = puzzle;
+                        smaller.setCell(i, 0);
+                        ASSERT_NE(canonicalizer.fingerprint(smaller), fingerprint);
+                        break;
+                }
+        }
+
+        Sudoku::Grid unsolved;
+        ASSERT_THROW(canonicalizer.canonicalize(puzzle, unsolved, canonical), std::invalid_argument);
+}
+
+/*
+Test for Canonicalizer::fingerprint() with many grids.
+
+Expected: Different grids have different fingerprints.
+*/
+TEST(Canonicalizer, Distinct)
+{
+        Sudoku::Canonicalizer canonicalizer;
+        Sudoku::Generator generator;
+        Sudoku::Random random(4);
+        Sudoku::Grid grid;
+        std::unordered_set<uint64_t> fingerprints;
+
+        for (int n = 0; n < 200; n++)
+        {
+                generator.generate(grid, random);
+                fingerprints.insert(canonicalizer.fingerprint(grid));
+        }
+
+        ASSERT_EQ(fingerprints.size(), 200);
+}
+
+#endif // !TEST
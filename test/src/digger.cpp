@@ -0,0 +1,161 @@
+/*
+Date: 18/10/2026
+
+This file provides a few tests for the Digger class.
+*/
+
+#ifndef TEST
+#error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
+#else
+
+#include "difficulty.hpp"
+#include "digger.hpp"
+#include "grid.hpp"
+#include "random.hpp"
+#include "solver.hpp"
+#include <gtest/gtest.h>
+
+namespace
+{
+        /*
+        Checks that a puzzle has a unique solution and agrees with it on every given.
+
+        @param puzzle The puzzle.
+        @param solution The expected solution.
+        */
+        void expectUnique(const Sudoku::Grid& puzzle, const Sudoku::Grid& solution)
+        {
+                Sudoku::Solver solver;
+                Sudoku::Grid grid = puzzle;
+
+                ASSERT_EQ(solver.countSolutions(grid, 2), 1);
+                ASSERT_TRUE(solution.isSolved());
+
+                for (size_t i = 0; i < puzzle.size(); i++)
+                {
+                        if (puzzle.getCell(i) != 0)
+                        {
+                                ASSERT_EQ(puzzle.getCell(i), solution.getCell(i));
+                        }
+                }
+        }
+} // namespace
+
+/*
+Test for Digger::generate() with a reachable number of givens.
+
+Expected: The puzzle has exactly the requested givens and a unique solution.
+*/
+TEST(Digger, Generate)
+{
+        Sudoku::Digger digger;
+        Sudoku::Random random(21);
+        Sudoku::Grid puzzle;
+        Sudoku::Grid solution;
+
+        for (size_t givens : {36, 31, 26})
+        {
+                for (int k = 0; k < 10; k++)
+                {
+                        ASSERT_TRUE(digger.generate(puzzle, solution, givens, random));
+                        ASSERT_EQ(puzzle.size() - puzzle.count(0), givens);
+                        expectUnique(puzzle, solution);
+                }
+        }
+}
+
+/*
+Test for Digger::generate() with the EXPERT number of givens.
+
+Expected: The puzzle has a unique solution and, if the target was missed, stays close to it. A miss
+within the tolerance counts as reached.
+*/
+TEST(Digger, Expert)
+{
+        Sudoku::Digger digger;
+        Sudoku::Random random(7);
+        Sudoku::Grid puzzle;
+        Sudoku::Grid solution;
+
+        for (int k = 0; k < 5; k++)
+        {
+                bool reached = digger.generate(puzzle, solution, 21, random);
+                size_t givens = puzzle.size() - puzzle.count(0);
+
+                ASSERT_TRUE(reached ? givens == 21 : givens > 21 && givens <= 25);
+                expectUnique(puzzle, solution);
+        }
+
+        // Within the tolerance a missed target still counts as reached
+        digger.setTolerance(Sudoku::GIVENS_TOLERANCE);
+        for (int k = 0; k < 5; k++)
+        {
+                bool reached = digger.generate(puzzle, solution, 21, random);
+                size_t givens = puzzle.size() - puzzle.count(0);
+
+                ASSERT_EQ(reached, givens <= 21 + Sudoku::GIVENS_TOLERANCE);
+                ASSERT_GE(givens, 21u);
+                ASSERT_GT(digger.getSolves(), 0u);
+                expectUnique(puzzle, solution);
+        }
+}
+
+/*
+Test for the symmetric patterns.
+
+Expected: Every removed cell has its symmetric cell removed too.
+*/
+TEST(Digger, Symmetry)
+{
+        Sudoku::Digger digger;
+        Sudoku::Random random(3);
+        Sudoku::Grid puzzle;
+        Sudoku::Grid solution;
+
+        digger.generate(puzzle, solution, 30, random, Sudoku::Symmetry::ROTATIONAL);
+        expectUnique(puzzle, solution);
+        for (size_t i = 0; i < puzzle.size(); i++)
+        {
+                ASSERT_EQ(puzzle.getCell(i) == 0, puzzle.getCell(80 - i) == 0);
+        }
+
+        digger.generate(puzzle, solution, 30, random, Sudoku::Symmetry::MIRROR);
+        expectUnique(puzzle, solution);
+        for (size_t i = 0; i < puzzle.size(); i++)
+        {
+                size_t row = i / 9;
+                size_t col = i % 9;
+                ASSERT_EQ(puzzle.getCell(i) == 0, puzzle.getCell(row * 9 + 8 - col) == 0);
+        }
+}
+
+/*
+Test for Digger::dig() on a solved grid.
+
+Expected: The same seed gives the same puzzle.
+*/
+TEST(Digger, Dig)
+{
+        Sudoku::Digger digger;
+        Sudoku::Grid solution;
+        Sudoku::Random random(11);
+
+        Sudoku::Grid first;
+        Sudoku::Grid second;
+        ASSERT_TRUE(digger.generate(first, solution, 28, random));
+
+        Sudoku::Grid grid = solution;
+        Sudoku::Random again(5);
+        Sudoku::Random replay(5);
+        ASSERT_TRUE(digger.dig(grid, 30, again));
+        second = solution;
+        ASSERT_TRUE(digger.dig(second, 30, replay));
+
+        expectUnique(grid, solution);
+        for (size_t i = 0; i < grid.size(); i++)
+        {
+                ASSERT_EQ(grid.getCell(i), second.getCell(i));
+        }
+}
+
+#endif // !TEST
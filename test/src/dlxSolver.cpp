@@ -0,0 +1,139 @@
+/*
+Date: 18/10/2026
+
+This file provides a few tests for the DlxSolver class.
+*/
+
+#ifndef TEST
+#error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
+#else
+
+#include "dlxSolver.hpp"
+#include "grid.hpp"
+#include "solverStrategy.hpp"
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string>
+
+/*
+Test for the DlxSolver::solve() method on a 17 clue puzzle.
+
+Expected: The grid is solved and the givens are kept.
+*/
+TEST(DlxSolver, Solve)
+{
+        const std::string puzzle =
+                "000000010400000000020000000000050407008000300001090000300400200050100000000806000";
+        Sudoku::Grid grid;
+        Sudoku::DlxSolver solver;
+
+        for (size_t i = 0; i < grid.size(); i++)
+        {
+                grid.setCell(i, puzzle[i] - '0');
+        }
+
+        Sudoku::Grid again = grid;
+
+        ASSERT_TRUE(solver.solve(grid));
+        ASSERT_TRUE(grid.isSolved());
+
+        for (size_t i = 0; i < grid.size(); i++)
+        {
+                if (puzzle[i] != '0')
+                {
+                        ASSERT_EQ(grid.getCell(i), puzzle[i] - '0');
+                }
+        }
+
+        // The nodes count the whole search, the same every time
+        uint64_t nodes = solver.getNodes();
+        ASSERT_GE(nodes, grid.size() - 17);
+        ASSERT_TRUE(solver.solve(again));
+        ASSERT_EQ(solver.getNodes(), nodes);
+}
+
+/*
+Test for the DlxSolver::solve() method on unsolvable grids.
+
+Expected: The solver fails and can still be reused afterwards.
+*/
+TEST(DlxSolver, Unsolvable)
+{
+        Sudoku::Grid grid;
+        Sudoku::DlxSolver solver;
+
+        // Two fives in the first row
+        grid.setCell(0, 5);
+        grid.setCell(8, 5);
+        ASSERT_FALSE(solver.solve(grid));
+
+        // No value is left for the first cell
+        std::array<int, 9> row = {0, 2, 3, 4, 5, 6, 7, 8, 9};
+        grid.clear();
+        grid.setRow(0, row);
+        grid.setCell(9, 1);
+        ASSERT_FALSE(solver.solve(grid));
+
+        // The matrix is restored after a failed solve
+        grid.clear();
+        ASSERT_TRUE(solver.solve(grid));
+        ASSERT_TRUE(grid.isSolved());
+}
+
+/*
+Test for the DlxSolver::countSolutions() method.
+
+Expected: The solutions are counted up to the limit and agree with the backtracking solver.
+*/
+TEST(DlxSolver, CountSolutions)
+{
+        const std::string puzzle =
+                "000000010400000000020000000000050407008000300001090000300400200050100000000806000";
+        Sudoku::Grid grid;
+        Sudoku::DlxSolver solver;
+
+        ASSERT_EQ(solver.countSolutions(grid), 2);
+        ASSERT_EQ(solver.countSolutions(grid, 100), 100);
+
+        for (size_t i = 0; i < grid.size(); i++)
+        {
+                grid.setCell(i, puzzle[i] - '0');
+        }
+
+        ASSERT_EQ(solver.countSolutions(grid), 1);
+
+        // Without one of the clues the 17 clue puzzle is no longer unique
+        grid.setCell(7, 0);
+        ASSERT_EQ(solver.countSolutions(grid), 2);
+
+        // Conflicting givens
+        grid.setCell(0, 4);
+        ASSERT_EQ(solver.countSolutions(grid), 0);
+}
+
+/*
+Test for the createSolver() factory.
+
+Expected: Every strategy solves the grid.
+*/
+TEST(DlxSolver, Strategy)
+{
+        std::array<int, 9> arr = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+        for (Sudoku::SolverType type : {Sudoku::SolverType::BACKTRACKING,
+                Sudoku::SolverType::DANCING_LINKS})
+        {
+                Sudoku::Grid grid;
+                std::unique_ptr<Sudoku::SolverStrategy> solver = Sudoku::createSolver(type);
+
+                grid.setBox(0, arr);
+                grid.setBox(4, arr);
+                grid.setBox(8, arr);
+
+                ASSERT_TRUE(solver->solve(grid));
+                ASSERT_TRUE(grid.isSolved());
+        }
+}
+
+#endif // !TEST
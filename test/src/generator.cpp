@@ -8,8 +8,8 @@ This file provides a few tests for the Generator class.
 #error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
 #else
 
-#include "../generator.hpp"
-#include "../grid.hpp"
+#include "generator.hpp"
+#include "grid.hpp"
 #include <array>
 #include <gtest/gtest.h>
 
@@ -27,6 +27,7 @@ TEST(Generator, Generate)
 
         ASSERT_TRUE(grid.count(0) == 0);
         ASSERT_TRUE(grid.isSolved());
+        ASSERT_GE(generator.getSolves(), 1u);
 }
 
 #endif // !TEST
\ No newline at end of file
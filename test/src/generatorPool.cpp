@@ -0,0 +1,102 @@
+/*
+Date: 18/10/2026
+
+This file provides a few tests for the GeneratorPool and ThreadPool classes.
+*/
+
+#ifndef TEST
+#error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
+#else
+
+#include "gameHandler.hpp"
+#include "generatorPool.hpp"
+#include "grid.hpp"
+#include "threadPool.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <vector>
+
+/*
+Test for the ThreadPool class with tasks which submit more tasks.
+
+Expected: Every task runs exactly once before wait() returns.
+*/
+TEST(GeneratorPool, ThreadPool)
+{
+        Sudoku::ThreadPool pool(4);
+        std::atomic<int> counter{0};
+
+        ASSERT_EQ(pool.size(), 4u);
+
+        for (int i = 0; i < 100; i++)
+        {
+                pool.submit([&pool, &counter]
+                {
+                        counter++;
+                        pool.submit([&counter] { counter++; });
+                });
+        }
+
+        pool.wait();
+        ASSERT_EQ(counter.load(), 200);
+
+        // The pool can be reused
+        pool.submit([&counter] { counter++; });
+        pool.wait();
+        ASSERT_EQ(counter.load(), 201);
+}
+
+/*
+Test for the GeneratorPool::generate() method.
+
+Expected: The puzzles have the number of givens of the difficulty, match their solution and
+        are the same for every number of threads.
+*/
+TEST(GeneratorPool, Generate)
+{
+        const size_t count = 200;
+        Sudoku::GeneratorPool pool(4);
+        Sudoku::GeneratorPool single(1);
+
+        std::vector<Sudoku::GeneratedPuzzle> puzzles = pool.generate(count, Sudoku::Difficulty::EASY, 42);
+        std::vector<Sudoku::GeneratedPuzzle> again = single.generate(count, Sudoku::Difficulty::EASY, 42);
+
+        ASSERT_EQ(puzzles.size(), count);
+
+        for (size_t k = 0; k < count; k++)
+        {
+                Sudoku::Grid puzzle;
+                Sudoku::Grid solution;
+
+                puzzle.unpack(puzzles[k].puzzle);
+                solution.unpack(puzzles[k].solution);
+
+                ASSERT_TRUE(solution.isSolved());
+                ASSERT_EQ(puzzle.count(0), puzzle.size() - static_cast<size_t>(Sudoku::Difficulty::EASY));
+
+                for (size_t i = 0; i < puzzle.size(); i++)
+                {
+                        if (puzzle.getCell(i) != 0)
+                        {
+                                ASSERT_EQ(puzzle.getCell(i), solution.getCell(i));
+                                ASSERT_TRUE(puzzle.isFixed(i));
+                        }
+                }
+
+                // Same master seed, same puzzles
+                ASSERT_EQ(puzzles[k].puzzle.cells, again[k].puzzle.cells);
+                ASSERT_EQ(puzzles[k].solution.cells, again[k].solution.cells);
+                ASSERT_EQ(puzzles[k].seed, Sudoku::GeneratorPool::puzzleSeed(42, k));
+        }
+
+        // Every puzzle can be generated again from its seed
+        Sudoku::GeneratedPuzzle replay = Sudoku::GeneratorPool::generateOne(Sudoku::Difficulty::EASY,
+                puzzles[7].seed);
+        ASSERT_EQ(replay.puzzle.cells, puzzles[7].puzzle.cells);
+
+        // Another master seed gives other puzzles
+        std::vector<Sudoku::GeneratedPuzzle> other = pool.generate(1, Sudoku::Difficulty::EASY, 43);
+        ASSERT_NE(other[0].solution.cells, puzzles[0].solution.cells);
+}
+
+#endif // !TEST
@@ -0,0 +1,122 @@
+/*
+Date: 18/10/2026
+
+This file provides a few tests for the Grader class.
+*/
+
+#ifndef TEST
+#error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
+#else
+
+#include "grader.hpp"
+#include "grid.hpp"
+#include "solver.hpp"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+        /*
+        Reads a puzzle from 81 characters, '.' is an empty cell.
+
+        @param text The puzzle.
+
+        @return The grid.
+        */
+        Sudoku::Grid parse(const std::string& text)
+        {
+                Sudoku::Grid grid;
+
+                for (size_t i = 0; i < grid.size(); i++)
+                {
+                        grid.setCell(i, text[i] == '.' ? 0 : text[i] - '0');
+                }
+
+                return grid;
+        }
+} // namespace
+
+/*
+Test for Grader::grade() with puzzles needing each technique.
+
+Expected: The hardest technique is found and the values placed match the solution.
+*/
+TEST(Grader, Techniques)
+{
+        const std::vector<std::pair<Sudoku::Technique, std::string>> puzzles = {
+                {Sudoku::Technique::HIDDEN_SINGLE, "25..7.8..7...95.3...3..26..6...8.52......3....81...4..9.............9.....65..1.."},
+                {Sudoku::Technique::NAKED_SINGLE, ".5.12.63.6...8.....2.......7.8.......3..7..1.9.63......7.............85...371..29"},
+                {Sudoku::Technique::POINTING, "..5.6...9......38...1........6..2.47.8..16..5.2.7..9......81...........6.5...47.3"},
+                {Sudoku::Technique::BOX_LINE, ".9..578.1.4..39.....8.......52..31....4...6.....9...757.5......4.....9...3.....8."},
+                {Sudoku::Technique::NAKED_PAIR, "....57...18.......2.3...........6......8..9.7..274.....6...2.4....6..5.8.385..72."},
+                {Sudoku::Technique::X_WING, "5..268......3.......9......2....4..389....2...4....6.9....59..6...61.5.8..3...1.."},
+                {Sudoku::Technique::HIDDEN_PAIR, "...65.3.7.......16.....2...87....5...4...6.......29..83...91..2......4..617.4...."},
+                {Sudoku::Technique::NAKED_TRIPLE, "7..2.....92.48......6.1.......7..2........89.....91....3.96...84.......1.9...47.3"},
+                {Sudoku::Technique::SWORDFISH, "...2....8...43....93...7.4...6.1....4..5.31..2...4......5...48......8.7.7......52"},
+                {Sudoku::Technique::XY_WING, "8......3..5...4..9...93..71..3.......6..521..7.2......1..3..5.....4....6..8.2.3.."},
+                {Sudoku::Technique::X_CHAIN, "...6...59...7.9....7.....4.....4..1.........8..52....6.549...8.8....6.....63.2..."},
+                {Sudoku::Technique::XY_CHAIN, "..72.6....2.............1.5.7.5..4.3.3.....7.9....4.5.6..7.8...498............96."}
+        };
+
+        Sudoku::Grader grader;
+        Sudoku::Solver solver;
+
+        for (const auto& [technique, text] : puzzles)
+        {
+                Sudoku::Grid solution = parse(text);
+                ASSERT_TRUE(solver.solve(solution));
+
+                Sudoku::Grade grade = grader.grade(parse(text));
+                ASSERT_EQ(grade.hardest, technique) << text;
+                ASSERT_TRUE(grade.solved);
+                ASSERT_GE(grade.score, grade.steps * Sudoku::Grader::getWeight(Sudoku::Technique::HIDDEN_SINGLE));
+
+                Sudoku::Grid result;
+                grader.getGrid(result);
+                for (size_t i = 0; i < result.size(); i++)
+                {
+                        ASSERT_EQ(result.getCell(i), solution.getCell(i));
+                }
+        }
+}
+
+/*
+Test for Grader::grade() with the edge cases.
+
+Expected: A solved grid needs nothing, a very hard puzzle needs guessing, which the grade counts, and an
+invalid grid throws.
+*/
+TEST(Grader, Limits)
+{
+        Sudoku::Grader grader;
+        Sudoku::Solver solver;
+
+        // AI Escargot is far beyond the techniques
+        const std::string escargot = "1....7.9..3..2...8..96..5....53..9...1..8...26....4...3......1..4......7..7...3..";
+        Sudoku::Grade grade = grader.grade(parse(escargot));
+        ASSERT_EQ(grade.hardest, Sudoku::Technique::GUESS);
+        ASSERT_FALSE(grade.solved);
+        ASSERT_GT(grade.guesses, 0u);
+
+        Sudoku::Grid grid = parse(escargot);
+        ASSERT_TRUE(solver.solve(grid));
+        grade = grader.grade(grid);
+        ASSERT_EQ(grade.hardest, Sudoku::Technique::NONE);
+        ASSERT_EQ(grade.score, 0);
+        ASSERT_TRUE(grade.solved);
+        ASSERT_EQ(grade.guesses, 0u);
+
+        // A single empty cell
+        grid.setCell(40, 0);
+        grade = grader.grade(grid);
+        ASSERT_EQ(grade.hardest, Sudoku::Technique::HIDDEN_SINGLE);
+        ASSERT_EQ(grade.steps, 1);
+
+        grid.setCell(40, grid.getCell(41));
+        ASSERT_THROW(grader.grade(grid), std::invalid_argument);
+}
+
+#endif // !TEST
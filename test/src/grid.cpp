@@ -8,8 +8,10 @@ This file provides a few tests for the Grid class.
 #error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
 #else
 
-#include "../grid.hpp"
+#include "grid.hpp"
+#include "gridTables.hpp"
 #include <array>
+#include <cstdint>
 #include <gtest/gtest.h>
 
 /*
@@ -33,17 +35,17 @@ TEST(Grid, Setters)
         int val = 1;
         std::array<int, 9> arr = {1, 2, 3, 4, 5, 6, 7, 8, 9};
 
-        grid.setCell(0, 0, 1);
-        grid.setCell(0, 0, val);
+        grid.setCell(grid.convertIndex(0, 0), 1);
+        grid.setCell(grid.convertIndex(0, 0), val);
         grid.setRow(0, arr);
         grid.setCol(0, arr);
         grid.setBox(0, arr);
 
         // Exceptions are thrown
-        ASSERT_THROW(grid.setCell(-1, 0, val), std::out_of_range);
-        ASSERT_THROW(grid.setCell(0, -1, val), std::out_of_range);
-        ASSERT_THROW(grid.setCell(9, 0, val), std::out_of_range);
-        ASSERT_THROW(grid.setCell(0, 9, val), std::out_of_range);
+        ASSERT_THROW(grid.setCell(-1, val), std::out_of_range);
+        ASSERT_THROW(grid.setCell(81, val), std::out_of_range);
+        ASSERT_THROW(grid.setCell(0, -1), std::invalid_argument);
+        ASSERT_THROW(grid.setCell(0, 10), std::invalid_argument);
 }
 
 /*
@@ -56,18 +58,19 @@ TEST(Grid, Getters)
         Sudoku::Grid grid;
         std::array<int, 9> setter = {1, 2, 3, 4, 5, 6, 7, 8, 9};
 
+        // Row 0 and column 0 only share their first cell, box 4 shares nothing with them
         grid.setRow(0, setter);
         grid.setCol(0, setter);
-        grid.setBox(0, setter);
+        grid.setBox(4, setter);
 
         std::array<int, 9> rowArray;
         std::array<int, 9> colArray;
         std::array<int, 9> boxArray;
 
-        grid.getCell(0, 0);
+        ASSERT_EQ(grid.getCell(0, 0), 1);
         grid.getRow(0, rowArray);
         grid.getCol(0, colArray);
-        grid.getBox(0, boxArray);
+        grid.getBox(4, boxArray);
 
         ASSERT_EQ(rowArray, setter);
         ASSERT_EQ(colArray, setter);
@@ -104,15 +107,15 @@ TEST(Grid, Index)
         ASSERT_THROW(grid.convertIndex(9, 0), std::out_of_range);
         ASSERT_THROW(grid.convertIndex(0, 9), std::out_of_range);
 
-        // checkIndex()
-        ASSERT_TRUE(grid.checkIndex(0, true));
-        ASSERT_TRUE(grid.checkIndex(80, true));
-        ASSERT_TRUE(grid.checkIndex(1, false));
+        // checkCellIndex() and checkIndex()
+        ASSERT_TRUE(grid.checkCellIndex(0));
+        ASSERT_TRUE(grid.checkCellIndex(80));
+        ASSERT_TRUE(grid.checkIndex(1));
 
-        ASSERT_FALSE(grid.checkIndex(-1, true));
-        ASSERT_FALSE(grid.checkIndex(81, true));
-        ASSERT_FALSE(grid.checkIndex(-1, true));
-        ASSERT_FALSE(grid.checkIndex(9, false));
+        ASSERT_FALSE(grid.checkCellIndex(-1));
+        ASSERT_FALSE(grid.checkCellIndex(81));
+        ASSERT_FALSE(grid.checkCellIndex(9, 0));
+        ASSERT_FALSE(grid.checkIndex(9));
 }
 
 /*
@@ -126,24 +129,228 @@ TEST(Grid, Check)
         std::array<int, 9> setter = {1, 2, 3, 4, 5, 6, 7, 8, 9};
 
         grid.setRow(0, setter);
-        grid.setCol(0, setter);
-        grid.setBox(0, setter);
 
         // True
-        ASSERT_TRUE(grid.isValidCell(0, 0));
-        ASSERT_TRUE(grid.isValidRow(0));
-        ASSERT_TRUE(grid.isValidCol(0));
-        ASSERT_TRUE(grid.isValidBox(0));
+        ASSERT_TRUE(grid.areValidValues(setter));
+        ASSERT_TRUE(grid.contains(9));
         ASSERT_TRUE(grid.isValid());
 
         // False
-        grid.setCell(0, 0, -1);
+        grid.setCell(grid.convertIndex(1, 0), 1);
         ASSERT_FALSE(grid.isSolved());
-        ASSERT_FALSE(grid.isValidCell(0, 0));
-        ASSERT_FALSE(grid.isValidRow(0));
-        ASSERT_FALSE(grid.isValidCol(0));
-        ASSERT_FALSE(grid.isValidBox(0));
+        ASSERT_FALSE(grid.areValidValues({0, 1, 2, 3, 4, 5, 6, 7, 10}));
         ASSERT_FALSE(grid.isValid());
 }
 
+/*
+Test for the candidate masks.
+
+Expected: The masks follow every setter and only allow values which do not break the rules.
+*/
+TEST(Grid, Candidates)
+{
+        Sudoku::Grid grid;
+        std::array<int, 9> setter = {1, 2, 3, 4, 5, 6, 7, 8, 0};
+
+        ASSERT_EQ(grid.candidates(0), Sudoku::ALL_CANDIDATES);
+        ASSERT_EQ(grid.candidateCount(40), 9);
+
+        grid.setRow(0, setter);
+
+        // Only 9 is left for the last cell of the first row
+        ASSERT_EQ(grid.candidates(8), 1 << 8);
+        ASSERT_EQ(grid.candidateCount(8), 1);
+        ASSERT_TRUE(grid.isValidValueToSet(8, 9));
+        ASSERT_FALSE(grid.isValidValueToSet(8, 1));
+        ASSERT_TRUE(grid.isValidValueToSet(8, 0));
+        ASSERT_FALSE(grid.isValidValueToSet(8, 10));
+
+        // A filled cell can always keep its own value
+        ASSERT_TRUE(grid.isValidValueToSet(0, 1));
+
+        // Column 0 and box 0 see the value 1
+        ASSERT_FALSE(grid.isValidValueToSet(27, 1));
+        ASSERT_FALSE(grid.isValidValueToSet(20, 1));
+        ASSERT_TRUE(grid.isValidValueToSet(31, 1));
+
+        // Removing a value frees it again
+        grid.setCell(0, 0);
+        ASSERT_TRUE(grid.isValidValueToSet(27, 1));
+
+        // Overwriting one of two duplicates keeps the other in the masks
+        grid.setCell(1, 3);
+        grid.setCell(1, 0);
+        ASSERT_FALSE(grid.isValidValueToSet(1, 3));
+        ASSERT_TRUE(grid.isValid());
+        grid.setCell(10, 2);
+        grid.setCell(9, 2);
+        ASSERT_FALSE(grid.isValid());
+
+        // A value held by a peer too is not a candidate of either cell
+        ASSERT_EQ(grid.candidates(9) & (1 << 1), 0);
+        ASSERT_EQ(grid.candidates(10) & (1 << 1), 0);
+        ASSERT_FALSE(grid.isValidValueToSet(9, 2));
+        grid.setCell(10, 0);
+        ASSERT_NE(grid.candidates(9) & (1 << 1), 0);
+
+        grid.clear();
+        ASSERT_EQ(grid.candidates(8), Sudoku::ALL_CANDIDATES);
+
+        ASSERT_THROW(grid.candidates(81), std::out_of_range);
+        ASSERT_THROW(grid.isValidValueToSet(81, 1), std::out_of_range);
+}
+
+/*
+Test for the packed form and the fixed flags.
+
+Expected: Packing and unpacking keeps the values and the fixed flags, fixGivens() fixes the filled
+cells and invalid values are rejected.
+*/
+TEST(Grid, Packing)
+{
+        Sudoku::Grid grid;
+        Sudoku::Grid unpacked;
+        Sudoku::PackedGrid packed;
+        std::array<int, 9> setter = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+        grid.setRow(4, setter);
+        grid.setFixed(36);
+        grid.setFixed(80);
+        grid.setCell(36, 5);
+
+        // The fixed flag does not change the value
+        ASSERT_TRUE(grid.isFixed(36));
+        ASSERT_EQ(grid.getCell(36), 5);
+        ASSERT_EQ(grid.count(1), 0);
+
+        grid.pack(packed);
+        unpacked.unpack(packed);
+
+        for (size_t i = 0; i < grid.size(); i++)
+        {
+                ASSERT_EQ(unpacked.getCell(i), grid.getCell(i));
+                ASSERT_EQ(unpacked.isFixed(i), grid.isFixed(i));
+                ASSERT_EQ(unpacked.candidates(i), grid.candidates(i));
+        }
+
+        ASSERT_LE(sizeof(Sudoku::PackedGrid), 64);
+
+        // Exactly the filled cells are fixed, the empty cell 80 no longer is
+        grid.fixGivens();
+        for (size_t i = 0; i < grid.size(); i++)
+        {
+                ASSERT_EQ(grid.isFixed(i), grid.getCell(i) != 0);
+        }
+
+        // Exceptions are thrown
+        ASSERT_THROW(grid.setCell(0, 10), std::invalid_argument);
+        ASSERT_THROW(grid.setCell(0, -1), std::invalid_argument);
+        ASSERT_THROW(grid.fill(10), std::invalid_argument);
+        ASSERT_THROW(grid.isFixed(81), std::out_of_range);
+}
+
+/*
+Test for the unchecked accessors and the index tables.
+
+Expected: The unchecked accessors agree with the checked ones and the tables describe the grid layout.
+*/
+TEST(Grid, Unchecked)
+{
+        Sudoku::Grid grid;
+        std::array<int, 9> setter = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+        grid.setBox(4, setter);
+        grid.setCellUnchecked(0, 5);
+
+        for (size_t i = 0; i < grid.size(); i++)
+        {
+                ASSERT_EQ(grid.getCellUnchecked(i), grid.getCell(i));
+                ASSERT_EQ(grid.candidatesUnchecked(i), grid.candidates(i));
+        }
+
+        // Row 0, column 0 and box 0 contain 5
+        ASSERT_EQ(grid.houseMaskUnchecked(0), 1 << 4);
+        ASSERT_EQ(grid.houseMaskUnchecked(9), 1 << 4);
+        ASSERT_EQ(grid.houseMaskUnchecked(22), Sudoku::ALL_CANDIDATES);
+
+        // Tables
+        ASSERT_EQ(Sudoku::Tables::ROW[40], 4);
+        ASSERT_EQ(Sudoku::Tables::COL[40], 4);
+        ASSERT_EQ(Sudoku::Tables::BOX[40], 4);
+        ASSERT_EQ(Sudoku::Tables::BOX[80], 8);
+        ASSERT_EQ(Sudoku::Tables::HOUSES[22][0], 30);
+        ASSERT_EQ(Sudoku::Tables::HOUSES[13][8], 76);
+
+        for (size_t i = 0; i < grid.size(); i++)
+        {
+                for (uint8_t peer : Sudoku::Tables::PEERS[i])
+                {
+                        ASSERT_NE(peer, i);
+                        ASSERT_TRUE(Sudoku::Tables::ROW[peer] == Sudoku::Tables::ROW[i]
+                                || Sudoku::Tables::COL[peer] == Sudoku::Tables::COL[i]
+                                || Sudoku::Tables::BOX[peer] == Sudoku::Tables::BOX[i]);
+                }
+        }
+}
+
+/*
+Test for the Zobrist hash.
+
+Expected: The hash follows every write, only depends on the values and matches a full rehash.
+*/
+TEST(Grid, Hash)
+{
+        Sudoku::Grid grid;
+        Sudoku::Grid other;
+        std::array<int, 9> setter = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+        ASSERT_EQ(grid.hash(), 0);
+
+        grid.setCell(10, 3);
+        uint64_t single = grid.hash();
+        ASSERT_NE(single, 0);
+
+        // Undoing a write restores the hash
+        grid.setCell(10, 7);
+        ASSERT_NE(grid.hash(), single);
+        grid.setCell(10, 3);
+        ASSERT_EQ(grid.hash(), single);
+        grid.setCell(10, 0);
+        ASSERT_EQ(grid.hash(), 0);
+
+        // The order of the writes and the fixed flags do not matter
+        grid.setRow(2, setter);
+        grid.setCellUnchecked(40, 6);
+        other.setCell(40, 6);
+        other.setCol(0, setter);
+        other.setRow(2, setter);
+        other.setFixed(40);
+        ASSERT_NE(grid.hash(), other.hash());
+        for (size_t row = 0; row < 9; row++)
+        {
+                if (row != 2)
+                {
+                        other.setCell(row * 9, 0);
+                }
+        }
+        ASSERT_EQ(grid.hash(), other.hash());
+
+        uint64_t expected = 0;
+        for (size_t i = 0; i < grid.size(); i++)
+        {
+                expected ^= Sudoku::Tables::ZOBRIST[i][grid.getCell(i)];
+        }
+        ASSERT_EQ(grid.hash(), expected);
+
+        Sudoku::PackedGrid packed;
+        grid.pack(packed);
+        other.unpack(packed);
+        ASSERT_EQ(other.hash(), grid.hash());
+
+        grid.fill(4);
+        ASSERT_NE(grid.hash(), other.hash());
+        grid.clear();
+        ASSERT_EQ(grid.hash(), 0);
+}
+
 #endif // !TEST
\ No newline at end of file
@@ -0,0 +1,165 @@
+/*
+Date: 18/10/2026
+
+This file provides a few tests for the RingBuffer and Pregenerator classes.
+*/
+
+#ifndef TEST
+#error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
+#else
+
+#include "difficulty.hpp"
+#include "gameHandler.hpp"
+#include "generatorPool.hpp"
+#include "grid.hpp"
+#include "pregenerator.hpp"
+#include "ringBuffer.hpp"
+#include <chrono>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace
+{
+        /*
+        Waits until the pregenerator has a puzzle of a difficulty ready.
+
+        @param pregenerator The pregenerator.
+        @param difficulty The difficulty.
+
+        @return True if a puzzle got ready in time, false otherwise.
+        */
+        bool waitReady(const Sudoku::Pregenerator& pregenerator, Sudoku::Difficulty difficulty)
+        {
+                for (int k = 0; k < 2000 && pregenerator.size(difficulty) == 0; k++)
+                {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                }
+
+                return pregenerator.size(difficulty) > 0;
+        }
+} // namespace
+
+/*
+Test for the RingBuffer class with a producer and a consumer thread.
+
+Expected: Every item arrives once and in order, a full buffer rejects pushes.
+*/
+TEST(RingBuffer, Order)
+{
+        Sudoku::RingBuffer<size_t, 8> buffer;
+        size_t item = 0;
+
+        ASSERT_FALSE(buffer.pop(item));
+        for (size_t i = 0; i < buffer.capacity(); i++)
+        {
+                ASSERT_TRUE(buffer.push(i));
+        }
+        ASSERT_FALSE(buffer.push(8));
+        ASSERT_EQ(buffer.size(), 8);
+        while (buffer.pop(item))
+        {
+        }
+
+        const size_t count = 200000;
+        std::thread producer([&buffer]
+        {
+                for (size_t i = 0; i < count; i++)
+                {
+                        while (!buffer.push(i))
+                        {
+                                std::this_thread::yield();
+                        }
+                }
+        });
+
+        for (size_t expected = 0; expected < count; expected++)
+        {
+                while (!buffer.pop(item))
+                {
+                        std::this_thread::yield();
+                }
+                ASSERT_EQ(item, expected);
+        }
+
+        producer.join();
+        ASSERT_EQ(buffer.size(), 0);
+}
+
+/*
+Test for the Pregenerator class.
+
+Expected: The ready puzzles are the puzzles of their seed and stopping joins the producer.
+*/
+TEST(Pregenerator, Pop)
+{
+        Sudoku::Pregenerator pregenerator;
+        Sudoku::GeneratedPuzzle puzzle;
+
+        ASSERT_FALSE(pregenerator.pop(Sudoku::Difficulty::EASY, puzzle));
+
+        pregenerator.start({true, false, true, false});
+        ASSERT_TRUE(pregenerator.isRunning());
+        ASSERT_TRUE(waitReady(pregenerator, Sudoku::Difficulty::EASY));
+        ASSERT_TRUE(waitReady(pregenerator, Sudoku::Difficulty::HARD));
+
+        ASSERT_TRUE(pregenerator.pop(Sudoku::Difficulty::HARD, puzzle));
+        Sudoku::GeneratedPuzzle again = Sudoku::GeneratorPool::generateOne(Sudoku::Difficulty::HARD, puzzle.seed);
+        ASSERT_EQ(puzzle.puzzle.cells, again.puzzle.cells);
+        ASSERT_EQ(puzzle.solution.cells, again.solution.cells);
+
+        ASSERT_EQ(pregenerator.size(Sudoku::Difficulty::MEDIUM), 0);
+        ASSERT_FALSE(pregenerator.pop(Sudoku::Difficulty::CHEAT, puzzle));
+
+        pregenerator.stop();
+        ASSERT_FALSE(pregenerator.isRunning());
+
+        // Puzzles generated before the stop are still there
+        ASSERT_TRUE(pregenerator.pop(Sudoku::Difficulty::EASY, puzzle));
+}
+
+/*
+Test for new games taken from the pregenerator.
+
+Expected: The game is replayed exactly from its seed, whether it was ready or generated on the
+spot.
+*/
+TEST(Pregenerator, Game)
+{
+        Sudoku::GameHandler game;
+        Sudoku::GameHandler replay;
+
+        game.startPregenerating();
+        for (int k = 0; k < 4; k++)
+        {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                game.newGame(Sudoku::Difficulty::MEDIUM);
+                replay.newGame(Sudoku::Difficulty::MEDIUM, game.seed);
+
+                Sudoku::Grid first;
+                Sudoku::Grid second;
+                game.getGrid(first);
+                replay.getGrid(second);
+                for (size_t i = 0; i < first.size(); i++)
+                {
+                        ASSERT_EQ(first.getCell(i), second.getCell(i));
+                }
+
+                // Hints come from the seed too
+                game.solve(3);
+                replay.solve(3);
+                game.getGrid(first);
+                replay.getGrid(second);
+                for (size_t i = 0; i < first.size(); i++)
+                {
+                        ASSERT_EQ(first.getCell(i), second.getCell(i));
+                }
+        }
+        game.stopPregenerating();
+
+        // Destroying a running pregenerator stops it
+        Sudoku::Pregenerator pregenerator;
+        pregenerator.start();
+}
+
+#endif // !TEST
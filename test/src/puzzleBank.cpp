@@ -0,0 +1,256 @@
+/*
+Date: 18/10/2026
+
+This file provides a few tests for the PuzzleBank class.
+*/
+
+#ifndef TEST
+#error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
+#else
+
+#include "difficulty.hpp"
+#include "gameHandler.hpp"
+#include "grader.hpp"
+#include "grid.hpp"
+#include "puzzleBank.hpp"
+#include "random.hpp"
+#include "solver.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+        /*
+        Returns a path in the temporary directory for a test file.
+
+        @param name The name of the file.
+
+        @return The path.
+        */
+        std::string tempPath(const std::string& name)
+        {
+                return (std::filesystem::temp_directory_path() / name).string();
+        }
+
+        /*
+        Returns numbers which no symmetry of the grid changes: the sorted number of givens of
+        every digit and of every row and column.
+
+        @param grid The puzzle.
+
+        @return The invariants.
+        */
+        std::array<size_t, 27> invariants(const Sudoku::Grid& grid)
+        {
+                std::array<size_t, 27> counts{};
+
+                for (size_t i = 0; i < grid.size(); i++)
+                {
+                        if (grid.getCell(i) != 0)
+                        {
+                                counts[grid.getCell(i) - 1]++;
+                                counts[9 + i / 9]++;
+                                counts[18 + i % 9]++;
+                        }
+                }
+
+                std::sort(counts.begin(), counts.begin() + 9);
+                std::sort(counts.begin() + 9, counts.end());
+
+                return counts;
+        }
+} // namespace
+
+/*
+Test for PuzzleBank::build() and PuzzleBank::open().
+
+Expected: Every record holds a unique puzzle of its section, its solution and its grade.
+*/
+TEST(PuzzleBank, Build)
+{
+        const std::string path = tempPath("sudoku_test.bank");
+        Sudoku::PuzzleBank::build(path, {20, 10, 5, 1}, 42, 2);
+
+        Sudoku::PuzzleBank bank(path);
+        ASSERT_TRUE(bank.isOpen());
+        ASSERT_EQ(bank.size(), 36);
+        ASSERT_EQ(bank.count(Sudoku::Difficulty::EASY), 20);
+        ASSERT_EQ(bank.count(Sudoku::Difficulty::EXPERT), 1);
+        ASSERT_EQ(bank.count(Sudoku::Difficulty::CHEAT), 0);
+
+        Sudoku::Solver solver;
+        Sudoku::Grader grader;
+        Sudoku::Grid puzzle;
+        Sudoku::Grid solution;
+
+        for (size_t i = 0; i < bank.size(); i++)
+        {
+                const Sudoku::BankRecord& record = bank.getRecord(i);
+                puzzle.unpack(record.puzzle);
+                solution.unpack(record.solution);
+
+                ASSERT_EQ(solver.countSolutions(puzzle, 2), 1);
+                ASSERT_TRUE(solution.isSolved());
+                ASSERT_EQ(grader.grade(puzzle).score, record.score);
+
+                Sudoku::Difficulty difficulty = static_cast<Sudoku::Difficulty>(record.difficulty);
+                ASSERT_EQ(bank.getSection(difficulty), i < 20 ? 0 : i < 30 ? 1 : i < 35 ? 2 : 3);
+                if (difficulty != Sudoku::Difficulty::EXPERT)
+                {
+                        ASSERT_EQ(puzzle.size() - puzzle.count(0), static_cast<size_t>(difficulty));
+                }
+        }
+
+        ASSERT_THROW(bank.getRecord(bank.size()), std::out_of_range);
+
+        // A pick always comes from the section of the difficulty
+        Sudoku::Random random(1);
+        for (int k = 0; k < 100; k++)
+        {
+                const Sudoku::BankRecord* record = bank.pick(Sudoku::Difficulty::HARD, random);
+                ASSERT_NE(record, nullptr);
+                ASSERT_EQ(record->difficulty, static_cast<uint8_t>(Sudoku::Difficulty::HARD));
+        }
+        ASSERT_EQ(bank.pick(Sudoku::Difficulty::CHEAT, random), nullptr);
+
+        bank.close();
+        ASSERT_FALSE(bank.isOpen());
+        ASSERT_EQ(bank.pick(Sudoku::Difficulty::HARD, random), nullptr);
+
+        std::filesystem::remove(path);
+}
+
+/*
+Test for the games picked from a bank.
+
+Expected: The game is a symmetric variant of a puzzle of the bank and is replayed from its seed.
+*/
+TEST(PuzzleBank, Game)
+{
+        const std::string path = tempPath("sudoku_game.bank");
+        Sudoku::PuzzleBank::build(path, {0, 8, 0, 0}, 7, 1);
+
+        Sudoku::PuzzleBank bank(path);
+        Sudoku::GameHandler game;
+        Sudoku::GameHandler replay;
+        ASSERT_TRUE(game.openBank(path));
+        ASSERT_TRUE(replay.openBank(path));
+
+        game.newGame(Sudoku::Difficulty::MEDIUM);
+        replay.newGame(Sudoku::Difficulty::MEDIUM, game.seed);
+
+        Sudoku::Grid first;
+        Sudoku::Grid second;
+        Sudoku::Grid record;
+        game.getGrid(first);
+        replay.getGrid(second);
+
+        bool found = false;
+        for (size_t i = 0; i < bank.size() && !found; i++)
+        {
+                record.unpack(bank.getRecord(i).puzzle);
+                found = invariants(record) == invariants(first);
+        }
+        ASSERT_TRUE(found);
+
+        Sudoku::Solver solver;
+        ASSERT_EQ(solver.countSolutions(first, 2), 1);
+
+        for (size_t j = 0; j < first.size(); j++)
+        {
+                ASSERT_EQ(first.getCell(j), second.getCell(j));
+                ASSERT_EQ(first.isFixed(j), first.getCell(j) != 0);
+        }
+
+        std::filesystem::remove(path);
+}
+
+/*
+Test for PuzzleBank::open() with files which are not banks.
+
+Expected: The files are rejected.
+*/
+TEST(PuzzleBank, Invalid)
+{
+        const std::string path = tempPath("sudoku_invalid.bank");
+        Sudoku::PuzzleBank bank;
+
+        ASSERT_THROW(bank.open(tempPath("sudoku_missing.bank")), std::runtime_error);
+
+        std::ofstream(path) << std::string(256, 'x');
+        ASSERT_THROW(bank.open(path), std::runtime_error);
+        ASSERT_FALSE(bank.isOpen());
+
+        Sudoku::GameHandler game;
+        ASSERT_FALSE(game.openBank(path));
+
+        std::filesystem::remove(path);
+}
+
+/*
+Test for the corrupt records of a bank.
+
+Expected: A corrupt record is never picked and the game generates its puzzle instead, with its
+givens fixed.
+*/
+TEST(PuzzleBank, Corrupt)
+{
+        const std::string path = tempPath("sudoku_corrupt.bank");
+        Sudoku::PuzzleBank::build(path, {0, 0, 1, 0}, 3, 1);
+
+        // A given which disagrees with the solution
+        Sudoku::BankRecord record = Sudoku::PuzzleBank(path).getRecord(0);
+        ASSERT_TRUE(Sudoku::PuzzleBank::isValidRecord(record));
+
+        Sudoku::Grid puzzle;
+        Sudoku::Grid solution;
+        puzzle.unpack(record.puzzle);
+        solution.unpack(record.solution);
+        for (size_t i = 0; i < puzzle.size(); i++)
+        {
+                if (puzzle.getCell(i) == 0)
+                {
+                        puzzle.setCell(i, solution.getCell(i) % 9 + 1);
+                        break;
+                }
+        }
+        puzzle.pack(record.puzzle);
+        ASSERT_FALSE(Sudoku::PuzzleBank::isValidRecord(record));
+
+        // A value out of range in the solution of the only hard record
+        {
+                std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+                file.seekp(sizeof(Sudoku::BankHeader) + offsetof(Sudoku::BankRecord, solution));
+                file.put(static_cast<char>(0xff));
+        }
+
+        Sudoku::PuzzleBank bank(path);
+        Sudoku::Random random(1);
+        ASSERT_FALSE(Sudoku::PuzzleBank::isValidRecord(bank.getRecord(0)));
+        ASSERT_EQ(bank.pick(Sudoku::Difficulty::HARD, random), nullptr);
+
+        Sudoku::GameHandler game;
+        ASSERT_TRUE(game.openBank(path));
+        ASSERT_NO_THROW(game.newGame(Sudoku::Difficulty::HARD, 5));
+
+        Sudoku::Grid grid;
+        Sudoku::Solver solver;
+        game.getGrid(grid);
+        ASSERT_EQ(solver.countSolutions(grid, 2), 1);
+
+        // The dug puzzle has its givens fixed like a picked one
+        for (size_t i = 0; i < grid.size(); i++)
+        {
+                ASSERT_EQ(grid.isFixed(i), grid.getCell(i) != 0);
+        }
+
+        std::filesystem::remove(path);
+}
+
+#endif // !TEST
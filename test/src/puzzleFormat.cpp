@@ -0,0 +1,62 @@
+/*
+Date: 18/10/2026
+
+This file provides a few tests for the PuzzleFormat class.
+*/
+
+#ifndef TEST
+#error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
+#else
+
+#include "grid.hpp"
+#include "puzzleFormat.hpp"
+#include <gtest/gtest.h>
+#include <string>
+
+/*
+Test for PuzzleFormat::parse() and PuzzleFormat::format().
+
+Expected: Both empty cell characters are read, trailing text is ignored and a puzzle is written
+back with zeros.
+*/
+TEST(PuzzleFormat, RoundTrip)
+{
+        const std::string line = "53..7....6..195....98....6.8...6...34..8.3..17...2...6.6....28....419..5....8..79 rated 1.2";
+        const std::string zeros = "530070000600195000098000060800060003400803001700020006060000280000419005000080079";
+        Sudoku::Grid grid;
+        Sudoku::PackedGrid packed;
+
+        ASSERT_TRUE(Sudoku::PuzzleFormat::parse(line, grid));
+        ASSERT_EQ(grid.getCell(0), 5);
+        ASSERT_EQ(grid.getCell(2), 0);
+        ASSERT_EQ(grid.getCell(80), 9);
+        ASSERT_FALSE(grid.isFixed(0));
+        ASSERT_EQ(Sudoku::PuzzleFormat::format(grid), zeros);
+
+        ASSERT_TRUE(Sudoku::PuzzleFormat::parse(zeros, packed));
+        ASSERT_EQ(Sudoku::PuzzleFormat::format(packed), zeros);
+
+        grid.pack(packed);
+        ASSERT_EQ(Sudoku::PuzzleFormat::format(packed), zeros);
+}
+
+/*
+Test for PuzzleFormat::parse() with lines which are not puzzles.
+
+Expected: Short lines and unknown characters are rejected, givens breaking the rules are not.
+*/
+TEST(PuzzleFormat, Invalid)
+{
+        Sudoku::Grid grid;
+        Sudoku::PackedGrid packed;
+
+        ASSERT_FALSE(Sudoku::PuzzleFormat::parse("", grid));
+        ASSERT_FALSE(Sudoku::PuzzleFormat::parse(std::string(80, '.'), grid));
+        ASSERT_FALSE(Sudoku::PuzzleFormat::parse(std::string(80, '.') + "x", grid));
+        ASSERT_FALSE(Sudoku::PuzzleFormat::parse(std::string(80, '.') + "x", packed));
+
+        ASSERT_TRUE(Sudoku::PuzzleFormat::parse("55" + std::string(79, '.'), grid));
+        ASSERT_FALSE(grid.isValid());
+}
+
+#endif // !TEST
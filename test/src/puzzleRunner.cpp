@@ -0,0 +1,127 @@
+/*
+Date: 18/10/2026
+
+This file provides a few tests for the PuzzleRunner class.
+*/
+
+#ifndef TEST
+#error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
+#else
+
+#include "grid.hpp"
+#include "puzzleFormat.hpp"
+#include "puzzleRunner.hpp"
+#include "solver.hpp"
+#include <array>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+        const std::array<std::string, 4> PUZZLES = {
+                "530070000600195000098000060800060003400803001700020006060000280000419005000080079",
+                "000000010400000000020000000000050407008000300001090000300400200050100000000806000",
+                "550070000600195000098000060800060003400803001700020006060000280000419005000080079",
+                "1....7.9..3..2...8..96..5....53..9...1..8...26....4...3......1..4......7..7...3.."
+        };
+} // namespace
+
+/*
+Test for PuzzleRunner::solve() with every engine and a few thread counts.
+
+Expected: Every engine solves the same puzzles to the same solutions and rejects the invalid one.
+*/
+TEST(PuzzleRunner, Engines)
+{
+        std::vector<std::string> expected;
+
+        for (Sudoku::Engine engine : {Sudoku::Engine::BACKTRACKING, Sudoku::Engine::DANCING_LINKS, Sudoku::Engine::BATCH})
+        {
+                for (size_t threads : {1, 3})
+                {
+                        Sudoku::PuzzleRunner runner(engine, threads);
+                        ASSERT_EQ(runner.getThreads(), threads);
+
+                        // Enough puzzles for a few chunks
+                        std::vector<Sudoku::PackedGrid> grids(200);
+                        std::vector<Sudoku::RunResult> results(grids.size());
+                        for (size_t k = 0; k < grids.size(); k++)
+                        {
+                                ASSERT_TRUE(Sudoku::PuzzleFormat::parse(PUZZLES[k % PUZZLES.size()], grids[k]));
+                        }
+
+                        ASSERT_EQ(runner.solve(grids.data(), grids.size(), results.data()), 150);
+
+                        for (size_t k = 0; k < grids.size(); k++)
+                        {
+                                bool valid = k % PUZZLES.size() != 2;
+                                ASSERT_EQ(results[k].status, valid ? Sudoku::SolverStatus::SOLVED : Sudoku::SolverStatus::UNSOLVABLE);
+
+                                if (valid)
+                                {
+                                        Sudoku::Grid grid;
+                                        grid.unpack(grids[k]);
+                                        ASSERT_TRUE(grid.isSolved());
+
+                                        if (expected.size() < PUZZLES.size())
+                                        {
+                                                expected.push_back(Sudoku::PuzzleFormat::format(grids[k]));
+                                        }
+                                        ASSERT_EQ(Sudoku::PuzzleFormat::format(grids[k]), expected[k % PUZZLES.size()]);
+                                }
+                                else if (expected.size() < PUZZLES.size())
+                                {
+                                        expected.push_back("");
+                                }
+                        }
+                }
+        }
+}
+
+/*
+Test for the engine names.
+
+Expected: Every name maps back to its engine and unknown names are rejected.
+*/
+TEST(PuzzleRunner, Names)
+{
+        Sudoku::Engine engine = Sudoku::Engine::BACKTRACKING;
+
+        for (Sudoku::Engine known : {Sudoku::Engine::BACKTRACKING, Sudoku::Engine::DANCING_LINKS, Sudoku::Engine::BATCH})
+        {
+                ASSERT_TRUE(Sudoku::PuzzleRunner::parseEngine(Sudoku::PuzzleRunner::getName(known), engine));
+                ASSERT_EQ(engine, known);
+        }
+
+        ASSERT_FALSE(Sudoku::PuzzleRunner::parseEngine("simd", engine));
+        ASSERT_EQ(engine, Sudoku::Engine::BATCH);
+}
+
+/*
+Test for PuzzleRunner::parseThreads().
+
+Expected: Counts in [1, maxThreads()] are accepted, zero, negative, oversized and malformed
+counts are rejected and leave the result untouched.
+*/
+TEST(PuzzleRunner, Threads)
+{
+        size_t threads = 0;
+        size_t max = Sudoku::PuzzleRunner::maxThreads();
+
+        ASSERT_GE(max, 4u);
+        ASSERT_TRUE(Sudoku::PuzzleRunner::parseThreads("1", threads));
+        ASSERT_EQ(threads, 1u);
+        ASSERT_TRUE(Sudoku::PuzzleRunner::parseThreads(std::to_string(max), threads));
+        ASSERT_EQ(threads, max);
+
+        std::vector<std::string> invalid = {"", "0", "-1", "+2", "2x", " 2", "18446744073709551615",
+                std::to_string(max + 1)};
+        for (const std::string& text : invalid)
+        {
+                ASSERT_FALSE(Sudoku::PuzzleRunner::parseThreads(text, threads)) << text;
+        }
+        ASSERT_EQ(threads, max);
+}
+
+#endif // !TEST
@@ -0,0 +1,161 @@
+/*
+Date: 18/10/2026
+
+This file provides a few tests for the Random class and the seeded game logic.
+*/
+
+#ifndef TEST
+#error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
+#else
+
+#include "gameHandler.hpp"
+#include "generator.hpp"
+#include "generatorPool.hpp"
+#include "grid.hpp"
+#include "random.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string>
+
+/*
+Test for the Random class.
+
+Expected: The same seed gives the same numbers, other seeds give other numbers.
+*/
+TEST(Random, Seed)
+{
+        Sudoku::Random first(12345);
+        Sudoku::Random second(12345);
+        Sudoku::Random other(12346);
+
+        // Reference value of SplitMix64 started at 0
+        ASSERT_EQ(Sudoku::Random::mix(0x9E3779B97F4A7C15ULL), 0xE220A8397B1DCDAFULL);
+
+        uint64_t value = first();
+        ASSERT_EQ(value, second());
+        ASSERT_NE(value, other());
+
+        for (int i = 0; i < 1000; i++)
+        {
+                ASSERT_EQ(first(), second());
+        }
+
+        // Reseeding restarts the sequence
+        first.seed(12345);
+        ASSERT_EQ(first(), value);
+
+        // Even seed 0 gives a usable state
+        Sudoku::Random zero(0);
+        ASSERT_NE(zero(), zero());
+}
+
+/*
+Test for Random::below() and Random::shuffle().
+
+Expected: The draws stay below their bound, the shuffles are permutations and both follow a fixed
+sequence for a seed, whatever the standard library.
+*/
+TEST(Random, Draws)
+{
+        Sudoku::Random random(12345);
+
+        // Reference values, they must not change with the platform
+        const std::array<uint64_t, 8> expected = {7, 1, 9, 0, 5, 0, 1, 2};
+        for (uint64_t value : expected)
+        {
+                ASSERT_EQ(random.below(10), value);
+        }
+
+        std::array<size_t, 3> counts{};
+        for (int i = 0; i < 3000; i++)
+        {
+                uint64_t value = random.below(3);
+                ASSERT_LT(value, 3u);
+                counts[value]++;
+        }
+        for (size_t count : counts)
+        {
+                ASSERT_GT(count, 900u);
+        }
+
+        ASSERT_EQ(random.below(1), 0u);
+        ASSERT_LT(random.below(UINT64_MAX), UINT64_MAX);
+
+        std::array<int, 9> values = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+        random.shuffle(values.begin(), values.end());
+        std::array<int, 9> sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+        ASSERT_EQ(sorted, (std::array<int, 9>{1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+/*
+Test for the generator with a fixed seed.
+
+Expected: The seed gives the same grid and the same puzzle on every platform.
+*/
+TEST(Random, Reference)
+{
+        const std::string grid = "281536947459127386637948215846213579713695824592784631325461798168379452974852163";
+        const std::string puzzle = "..153.9...5..27.........2..8.6....797...9..2..92..4....2.4..79..68....5.97..52.63";
+
+        Sudoku::Generator generator;
+        Sudoku::Grid filled;
+        Sudoku::Random random(7);
+        generator.generate(filled, random);
+
+        Sudoku::GeneratedPuzzle generated = Sudoku::GeneratorPool::generateOne(Sudoku::Difficulty::MEDIUM, 7);
+        Sudoku::Grid given;
+        given.unpack(generated.puzzle);
+
+        for (size_t i = 0; i < filled.size(); i++)
+        {
+                ASSERT_EQ(filled.getCell(i), grid[i] - '0');
+                ASSERT_EQ(given.getCell(i), puzzle[i] == '.' ? 0 : puzzle[i] - '0');
+        }
+}
+
+/*
+Test for the generator and the game handler with a seed.
+
+Expected: The same seed always gives the same grid and the same game.
+*/
+TEST(Random, Replay)
+{
+        Sudoku::Generator generator;
+        Sudoku::Grid first;
+        Sudoku::Grid second;
+        Sudoku::Random random(7);
+        Sudoku::Random again(7);
+
+        generator.generate(first, random);
+        generator.generate(second, again);
+
+        ASSERT_TRUE(first.isSolved());
+        for (size_t i = 0; i < first.size(); i++)
+        {
+                ASSERT_EQ(first.getCell(i), second.getCell(i));
+        }
+
+        Sudoku::GameHandler game;
+        Sudoku::GameHandler replay;
+
+        game.newGame(Sudoku::Difficulty::MEDIUM);
+        replay.newGame(Sudoku::Difficulty::MEDIUM, game.seed);
+
+        // Hints come from the seed too
+        game.solve(5);
+        replay.solve(5);
+
+        game.getGrid(first);
+        replay.getGrid(second);
+
+        for (size_t i = 0; i < first.size(); i++)
+        {
+                ASSERT_EQ(first.getCell(i), second.getCell(i));
+        }
+}
+
+#endif // !TEST
@@ -8,10 +8,12 @@ This file provides a few tests for the Solver class.
 #error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
 #else
 
-#include "../grid.hpp"
-#include "../solver.hpp"
+#include "grid.hpp"
+#include "solver.hpp"
 #include <array>
+#include <cstdint>
 #include <gtest/gtest.h>
+#include <string>
 
 /*
 Test for the Solver::solve() method.
@@ -32,4 +34,178 @@ TEST(Solver, Solve)
         ASSERT_TRUE(grid.isSolved());
 }
 
+/*
+Test for the Solver::solve() method on hard puzzles.
+
+Expected: The grids are solved and the givens are kept.
+*/
+TEST(Solver, SolveHard)
+{
+        const std::array<std::string, 2> puzzles = {
+                "000000010400000000020000000000050407008000300001090000300400200050100000000806000",
+                "400000805030000000000700000020000060000080400000010000000603070500200000104000000"
+        };
+        Sudoku::Solver solver;
+
+        for (const std::string& puzzle : puzzles)
+        {
+                Sudoku::Grid grid;
+
+                for (size_t i = 0; i < grid.size(); i++)
+                {
+                        grid.setCell(i, puzzle[i] - '0');
+                }
+
+                ASSERT_TRUE(solver.solve(grid));
+                ASSERT_TRUE(grid.isSolved());
+
+                for (size_t i = 0; i < grid.size(); i++)
+                {
+                        if (puzzle[i] != '0')
+                        {
+                                ASSERT_EQ(grid.getCell(i), puzzle[i] - '0');
+                        }
+                }
+        }
+}
+
+/*
+Test for the Solver::countSolutions() method.
+
+Expected: The solutions are counted up to the limit and invalid grids have none.
+*/
+TEST(Solver, CountSolutions)
+{
+        Sudoku::Grid grid;
+        Sudoku::Solver solver;
+
+        // An empty grid has many solutions
+        ASSERT_EQ(solver.countSolutions(grid), 2);
+        ASSERT_EQ(solver.countSolutions(grid, 5), 5);
+        ASSERT_EQ(solver.countSolutions(grid, 0), 0);
+
+        // A solved grid has exactly one
+        ASSERT_TRUE(solver.solve(grid));
+        ASSERT_EQ(solver.countSolutions(grid), 1);
+
+        // Removing a single cell keeps the solution unique
+        int value = grid.getCell(40);
+        grid.setCell(40, 0);
+        ASSERT_EQ(solver.countSolutions(grid), 1);
+
+        // Conflicting values have no solution
+        grid.setCell(40, value == 1 ? 2 : 1);
+        ASSERT_EQ(solver.countSolutions(grid), 0);
+        ASSERT_FALSE(solver.solve(grid));
+}
+
+/*
+Test for the Solver::start() and Solver::resume() methods.
+
+Expected: A search paused after every node ends with the same solution as an uninterrupted one.
+*/
+TEST(Solver, Resume)
+{
+        const std::string puzzle =
+                "400000805030000000000700000020000060000080400000010000000603070500200000104000000";
+        Sudoku::Grid grid;
+        Sudoku::Grid expected;
+        Sudoku::Solver solver;
+
+        for (size_t i = 0; i < grid.size(); i++)
+        {
+                grid.setCell(i, puzzle[i] - '0');
+        }
+
+        expected = grid;
+        ASSERT_TRUE(solver.solve(expected));
+
+        solver.start(grid);
+
+        int slices = 0;
+        Sudoku::SolverStatus status = Sudoku::SolverStatus::IN_PROGRESS;
+
+        while (status == Sudoku::SolverStatus::IN_PROGRESS)
+        {
+                status = solver.resume(grid, 1);
+                slices++;
+        }
+
+        ASSERT_EQ(status, Sudoku::SolverStatus::SOLVED);
+        ASSERT_GT(slices, 1);
+
+        for (size_t i = 0; i < grid.size(); i++)
+        {
+                ASSERT_EQ(grid.getCell(i), expected.getCell(i));
+        }
+
+        // Invalid grids are not searched at all
+        grid.setCell(1, grid.getCell(0));
+        solver.start(grid);
+        ASSERT_EQ(solver.resume(grid, 1), Sudoku::SolverStatus::UNSOLVABLE);
+}
+
+/*
+Test for the StatsSolver class.
+
+Expected: The statistics match a search paused after every node, a search without guessing has a
+single node and the statistics are reset by every search.
+*/
+TEST(Solver, Stats)
+{
+        const std::string puzzle =
+                "400000805030000000000700000020000060000080400000010000000603070500200000104000000";
+        Sudoku::Grid grid;
+        Sudoku::StatsSolver solver;
+
+        for (size_t i = 0; i < grid.size(); i++)
+        {
+                grid.setCell(i, puzzle[i] - '0');
+        }
+
+        // Count the nodes by pausing after every one
+        Sudoku::Grid copy = grid;
+        Sudoku::Solver plain;
+        uint64_t slices = 0;
+
+        plain.start(copy);
+        while (plain.resume(copy, 1) == Sudoku::SolverStatus::IN_PROGRESS)
+        {
+                slices++;
+        }
+
+        ASSERT_TRUE(solver.solve(grid));
+        ASSERT_TRUE(grid.isSolved());
+
+        const Sudoku::SolverStats& stats = solver.getStats();
+        ASSERT_EQ(stats.nodes, slices + 1);
+        // Every node but the first is entered after a guess
+        ASSERT_EQ(stats.guesses, stats.nodes - 1);
+        ASSERT_LT(stats.backtracks, stats.nodes);
+        ASSERT_GT(stats.maxDepth, 0u);
+        ASSERT_GT(stats.propagations, 0u);
+        ASSERT_GT(stats.nanoseconds, 0u);
+
+        // A solved grid with one cell removed needs no guessing
+        grid.setCell(40, 0);
+        ASSERT_TRUE(solver.solve(grid));
+        ASSERT_EQ(solver.getStats().nodes, 1u);
+        ASSERT_EQ(solver.getStats().guesses, 0u);
+        ASSERT_EQ(solver.getStats().backtracks, 0u);
+        ASSERT_EQ(solver.getStats().maxDepth, 0u);
+        ASSERT_EQ(solver.getStats().propagations, 1u);
+
+        // A puzzle with a wrong given which breaks no rule is only rejected by dead ends
+        const std::string unsolvable =
+                "000000907000420180000705026100934000050000040000507009920108000034059000507000000";
+        for (size_t i = 0; i < grid.size(); i++)
+        {
+                grid.setCell(i, unsolvable[i] - '0');
+        }
+
+        ASSERT_FALSE(solver.solve(grid));
+        ASSERT_GT(solver.getStats().backtracks, 0u);
+        ASSERT_EQ(solver.getStats().guesses, solver.getStats().nodes - 1);
+}
+
 #endif // !TEST
\ No newline at end of file
@@ -0,0 +1,152 @@
+/*
+Date: 18/10/2026
+
+This file provides a few tests for the Tracer class.
+*/
+
+#ifndef TEST
+#error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
+#else
+
+#include "tracer.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace
+{
+        /*
+        Returns the number of times a text occurs in a string.
+
+        @param text The string.
+        @param pattern The text to count.
+
+        @return The number of occurrences.
+        */
+        size_t occurrences(const std::string& text, const std::string& pattern)
+        {
+                size_t count = 0;
+
+                for (size_t position = text.find(pattern); position != std::string::npos;
+                        position = text.find(pattern, position + 1))
+                {
+                        count++;
+                }
+
+                return count;
+        }
+} // namespace
+
+/*
+Test for ScopedSpan and Tracer::write().
+
+Expected: Every span of every thread is written once, nested spans lie within their parent and
+the threads carry their names.
+*/
+TEST(Tracer, Write)
+{
+        Sudoku::Tracer::clear();
+
+        {
+                Sudoku::ScopedSpan outer("outer");
+                Sudoku::ScopedSpan inner("inner \"quoted\"");
+        }
+
+        std::thread worker([]
+        {
+                Sudoku::Tracer::setThreadName("tracer test");
+                for (int k = 0; k < 3; k++)
+                {
+                        Sudoku::ScopedSpan span("worker");
+                }
+        });
+        worker.join();
+
+        ASSERT_EQ(Sudoku::Tracer::size(), 5u);
+
+        std::string path = (std::filesystem::temp_directory_path() / "sudoku_test.trace.json").string();
+        Sudoku::Tracer::write(path);
+
+        std::ifstream file(path);
+        std::stringstream stream;
+        stream << file.rdbuf();
+        std::string trace = stream.str();
+        std::filesystem::remove(path);
+
+        ASSERT_EQ(trace.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0u);
+        ASSERT_EQ(occurrences(trace, "\"ph\":\"X\""), 5u);
+        ASSERT_EQ(occurrences(trace, "\"name\":\"outer\""), 1u);
+        ASSERT_EQ(occurrences(trace, "\"name\":\"inner \\\"quoted\\\"\""), 1u);
+        ASSERT_EQ(occurrences(trace, "\"name\":\"worker\""), 3u);
+        ASSERT_EQ(occurrences(trace, "\"args\":{\"name\":\"tracer test\"}"), 1u);
+
+        ASSERT_THROW(Sudoku::Tracer::write("/nonexistent/directory/trace.json"), std::runtime_error);
+}
+
+/*
+Test for Tracer::clear() with a thread which ended.
+
+Expected: The buffer of the ended thread is freed, the running thread keeps its buffer and name.
+*/
+TEST(Tracer, Release)
+{
+        Sudoku::Tracer::setThreadName("tracer main");
+
+        std::thread worker([]
+        {
+                Sudoku::Tracer::setThreadName("tracer ended");
+                Sudoku::ScopedSpan span("worker");
+        });
+        worker.join();
+
+        std::string path = (std::filesystem::temp_directory_path() / "sudoku_release.trace.json").string();
+        auto read = [&path]
+        {
+                Sudoku::Tracer::write(path);
+                std::ifstream file(path);
+                std::stringstream stream;
+                stream << file.rdbuf();
+                std::filesystem::remove(path);
+                return stream.str();
+        };
+
+        // Kept until clear(), so the spans of the worker are written
+        std::string trace = read();
+        ASSERT_EQ(occurrences(trace, "\"args\":{\"name\":\"tracer ended\"}"), 1u);
+
+        Sudoku::Tracer::clear();
+        trace = read();
+        ASSERT_EQ(occurrences(trace, "\"args\":{\"name\":\"tracer ended\"}"), 0u);
+        ASSERT_EQ(occurrences(trace, "\"args\":{\"name\":\"tracer main\"}"), 1u);
+}
+
+/*
+Test for the ring buffer of Tracer::record().
+
+Expected: A thread keeps its last CAPACITY spans and clear() drops them all.
+*/
+TEST(Tracer, Ring)
+{
+        Sudoku::Tracer::clear();
+
+        std::thread worker([]
+        {
+                for (size_t k = 0; k < Sudoku::Tracer::CAPACITY + 10; k++)
+                {
+                        Sudoku::Tracer::record("span", k, k + 1);
+                }
+        });
+        worker.join();
+
+        ASSERT_EQ(Sudoku::Tracer::size(), Sudoku::Tracer::CAPACITY);
+
+        Sudoku::Tracer::clear();
+        ASSERT_EQ(Sudoku::Tracer::size(), 0u);
+}
+
+#endif // !TEST
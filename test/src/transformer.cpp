@@ -0,0 +1,101 @@
+/*
+Date: 18/10/2026
+
+This file provides a few tests for the Transformer class.
+*/
+
+#ifndef TEST
+#error "Tried to compile a test file without the TEST macro defined. Aborting compilation."
+#else
+
+#include "digger.hpp"
+#include "grid.hpp"
+#include "random.hpp"
+#include "solver.hpp"
+#include "transformer.hpp"
+#include <gtest/gtest.h>
+
+/*
+Test for Transformer::apply() with the identity.
+
+Expected: The grid and its fixed flags are unchanged.
+*/
+TEST(Transformer, Identity)
+{
+        Sudoku::Digger digger;
+        Sudoku::Random random(1);
+        Sudoku::Grid puzzle;
+        Sudoku::Grid solution;
+        digger.generate(puzzle, solution, 30, random);
+        puzzle.setFixed(0);
+
+        Sudoku::Grid result;
+        Sudoku::Transformer::apply(Sudoku::Transformer::identity(), puzzle, result);
+
+        for (size_t i = 0; i < puzzle.size(); i++)
+        {
+                ASSERT_EQ(result.getCell(i), puzzle.getCell(i));
+                ASSERT_EQ(result.isFixed(i), puzzle.isFixed(i));
+        }
+}
+
+/*
+Test for Transformer::apply() with random transformations.
+
+Expected: A solved grid stays solved and a unique puzzle stays unique with the transformed
+solution, the givens and their fixed flags move together.
+*/
+TEST(Transformer, Random)
+{
+        Sudoku::Digger digger;
+        Sudoku::Solver solver;
+        Sudoku::Random random(2);
+        Sudoku::Grid puzzle;
+        Sudoku::Grid solution;
+        digger.generate(puzzle, solution, 26, random);
+
+        for (size_t i = 0; i < puzzle.size(); i++)
+        {
+                puzzle.setFixed(i, puzzle.getCell(i) != 0);
+        }
+
+        bool changed = false;
+
+        for (int k = 0; k < 50; k++)
+        {
+                Sudoku::Transformation transformation = Sudoku::Transformer::random(random);
+                Sudoku::Grid newPuzzle;
+                Sudoku::Grid newSolution = solution;
+
+                Sudoku::Transformer::apply(transformation, puzzle, newPuzzle);
+                Sudoku::Transformer::apply(transformation, newSolution);
+
+                ASSERT_TRUE(newSolution.isSolved());
+                ASSERT_EQ(newPuzzle.count(0), puzzle.count(0));
+                ASSERT_EQ(solver.countSolutions(newPuzzle, 2), 1);
+
+                for (size_t i = 0; i < newPuzzle.size(); i++)
+                {
+                        ASSERT_EQ(newPuzzle.isFixed(i), newPuzzle.getCell(i) != 0);
+                        if (newPuzzle.getCell(i) != 0)
+                        {
+                                ASSERT_EQ(newPuzzle.getCell(i), newSolution.getCell(i));
+                        }
+                        changed = changed || newSolution.getCell(i) != solution.getCell(i);
+                }
+        }
+
+        ASSERT_TRUE(changed);
+
+        // The same seed draws the same transformation
+        Sudoku::Random first(9);
+        Sudoku::Random second(9);
+        Sudoku::Transformation a = Sudoku::Transformer::random(first);
+        Sudoku::Transformation b = Sudoku::Transformer::random(second);
+        ASSERT_EQ(a.digits, b.digits);
+        ASSERT_EQ(a.rows, b.rows);
+        ASSERT_EQ(a.cols, b.cols);
+        ASSERT_EQ(a.transpose, b.transpose);
+}
+
+#endif // !TEST